@@ -21,6 +21,9 @@
 #include <util/delay.h>
 #include <avr/io.h>
 #include "hd44780.h"
+#if HD44780_USE_TRACE
+#include "hd44780_trace.h"
+#endif
 
 // +---------------------------+
 // |         Power on          |
@@ -86,6 +89,143 @@ void HD44780_DisplayClear (void)
   HD44780_SendInstruction(HD44780_DISP_CLEAR);
 }
 
+// cached registers, 0xFF until sent
+static unsigned char HD44780_DispCtrl = 0xFF;
+static unsigned char HD44780_EntryMode = 0xFF;
+static unsigned char HD44780_FuncSet = 0xFF;
+// cached DDRAM address counter, 0xFF unknown (CGRAM, line end)
+static unsigned char HD44780_Address = 0xFF;
+
+/**
+ * @desc    Send display control only if register changes
+ *
+ * @param   unsigned char
+ *
+ * @return  void
+ */
+static void HD44780_WriteDisplayControl (unsigned char value)
+{
+  // changed
+  if (value != HD44780_DispCtrl) {
+    HD44780_SendInstruction(value);
+  }
+}
+
+/**
+ * @desc    Send entry mode only if register changes
+ *
+ * @param   unsigned char
+ *
+ * @return  void
+ */
+static void HD44780_WriteEntryMode (unsigned char value)
+{
+  // changed
+  if (value != HD44780_EntryMode) {
+    HD44780_SendInstruction(value);
+  }
+}
+
+/**
+ * @desc    Set / clear bit of display control register
+ *
+ * @param   unsigned char bit {HD44780_DISP_D; HD44780_DISP_C; HD44780_DISP_B}
+ * @param   char {0; 1}
+ *
+ * @return  void
+ */
+static void HD44780_SetDisplayControlBit (unsigned char bit, char on)
+{
+  // cached value, display off if unknown
+  unsigned char value = (HD44780_DispCtrl == 0xFF) ? HD44780_DISP_OFF : HD44780_DispCtrl;
+
+  // set / clear bit
+  if (on) {
+    value |= bit;
+  } else {
+    value &= ~bit;
+  }
+  // send if changed
+  HD44780_WriteDisplayControl(value);
+}
+
+/**
+ * @desc    Update register cache by instruction sent to LCD
+ *
+ * @param   unsigned char
+ *
+ * @return  void
+ */
+void HD44780_CacheUpdate (unsigned char instruction)
+{
+  // set DDRAM address
+  if (instruction & HD44780_POSITION) {
+    HD44780_Address = instruction & 0x7F;
+    return;
+  }
+  // set CGRAM address, cursor shift - address counter not tracked
+  if ((instruction & HD44780_CGRAM) || ((instruction & 0xF8) == HD44780_SHIFT)) {
+    HD44780_Address = 0xFF;
+    return;
+  }
+  // display shift keeps address counter
+  if ((instruction & 0xF0) == HD44780_SHIFT) {
+    return;
+  }
+  // display clear, return home
+  if (instruction < HD44780_ENTRY) {
+    HD44780_Address = 0;
+  }
+  // function set
+  if (instruction & HD44780_FUNCTION) {
+    HD44780_FuncSet = instruction;
+  // display control
+  } else if (instruction & HD44780_DISP_CTRL) {
+    HD44780_DispCtrl = instruction;
+  // entry mode
+  } else if (instruction & HD44780_ENTRY) {
+    HD44780_EntryMode = instruction;
+  // display clear sets I/D
+  } else if ((instruction == HD44780_DISP_CLEAR) && (HD44780_EntryMode != 0xFF)) {
+    HD44780_EntryMode |= HD44780_ENTRY_INC;
+  }
+}
+
+/**
+ * @desc    Update cached address counter by data write,
+ *          moves by I/D of cached entry mode
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_CacheData (void)
+{
+  // unknown address or direction
+  if ((HD44780_Address == 0xFF) || (HD44780_EntryMode == 0xFF)) {
+    HD44780_Address = 0xFF;
+  // increment, wrap at end of line depends on lines
+  } else if (HD44780_EntryMode & HD44780_ENTRY_INC) {
+    HD44780_Address = ((HD44780_Address & 0x3F) == 0x27) ? 0xFF : (HD44780_Address + 1);
+  // decrement, wrap at start of line
+  } else {
+    HD44780_Address = ((HD44780_Address & 0x3F) == 0x00) ? 0xFF : (HD44780_Address - 1);
+  }
+}
+
+/**
+ * @desc    Get cached DDRAM address counter, no bus traffic
+ *
+ * @param   void
+ *
+ * @return  unsigned char address, 0xFF if unknown
+ */
+unsigned char HD44780_GetAddress (void)
+{
+  // no bus traffic
+  return HD44780_Address;
+}
+
 /**
  * @desc    LCD display on
  *
@@ -96,9 +236,23 @@ void HD44780_DisplayClear (void)
 void HD44780_DisplayOn (void)
 {
   // send instruction - display on
-  HD44780_SendInstruction(HD44780_DISP_ON);
+  HD44780_WriteDisplayControl(HD44780_DISP_ON);
+}
+
+/**
+ * @desc    LCD display off, DDRAM content is kept
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_DisplayOff (void)
+{
+  // send instruction - display off
+  HD44780_WriteDisplayControl(HD44780_DISP_OFF);
 }
 
+#if HD44780_USE_CURSOR
 /**
  * @desc    LCD cursor on, display on
  *
@@ -109,7 +263,7 @@ void HD44780_DisplayOn (void)
 void HD44780_CursorOn (void)
 {
   // send instruction - cursor on
-  HD44780_SendInstruction(HD44780_CURSOR_ON);
+  HD44780_WriteDisplayControl(HD44780_CURSOR_ON);
 }
 
 /**
@@ -122,7 +276,7 @@ void HD44780_CursorOn (void)
 void HD44780_CursorOff (void)
 {
   // send instruction - cursor on
-  HD44780_SendInstruction(HD44780_CURSOR_OFF);
+  HD44780_WriteDisplayControl(HD44780_CURSOR_OFF);
 }
 
 /**
@@ -135,7 +289,112 @@ void HD44780_CursorOff (void)
 void HD44780_CursorBlink (void)
 {
   // send instruction - Cursor blink
-  HD44780_SendInstruction(HD44780_CURSOR_BLINK);
+  HD44780_WriteDisplayControl(HD44780_CURSOR_BLINK);
+}
+#endif
+
+/**
+ * @desc    LCD display on / off, cursor and blink are kept
+ *
+ * @param   char {0; 1}
+ *
+ * @return  void
+ */
+void HD44780_SetDisplay (char on)
+{
+  // bit D
+  HD44780_SetDisplayControlBit(HD44780_DISP_D, on);
+}
+
+#if HD44780_USE_CURSOR
+/**
+ * @desc    LCD cursor on / off, display and blink are kept
+ *
+ * @param   char {0; 1}
+ *
+ * @return  void
+ */
+void HD44780_SetCursor (char on)
+{
+  // bit C
+  HD44780_SetDisplayControlBit(HD44780_DISP_C, on);
+}
+
+/**
+ * @desc    LCD blink on / off, display and cursor are kept
+ *
+ * @param   char {0; 1}
+ *
+ * @return  void
+ */
+void HD44780_SetBlink (char on)
+{
+  // bit B
+  HD44780_SetDisplayControlBit(HD44780_DISP_B, on);
+}
+#endif
+
+/**
+ * @desc    LCD entry mode, instruction is sent only if mode changes
+ *
+ * @param   char increment {1 - increment; 0 - decrement}
+ * @param   char shift {1 - shift display; 0 - no shift}
+ *
+ * @return  void
+ */
+void HD44780_SetEntryMode (char increment, char shift)
+{
+  unsigned char value = HD44780_ENTRY;
+
+  // I/D
+  if (increment) {
+    value |= HD44780_ENTRY_INC;
+  }
+  // S
+  if (shift) {
+    value |= HD44780_ENTRY_SHIFT;
+  }
+  // send if changed
+  HD44780_WriteEntryMode(value);
+}
+
+/**
+ * @desc    Get cached display control register (0x08 | D | C | B)
+ *
+ * @param   void
+ *
+ * @return  unsigned char
+ */
+unsigned char HD44780_GetDisplayControl (void)
+{
+  // no bus traffic
+  return HD44780_DispCtrl;
+}
+
+/**
+ * @desc    Get cached entry mode register (0x04 | I/D | S)
+ *
+ * @param   void
+ *
+ * @return  unsigned char
+ */
+unsigned char HD44780_GetEntryMode (void)
+{
+  // no bus traffic
+  return HD44780_EntryMode;
+}
+
+/**
+ * @desc    Get cached function set register (0x20 | DL | N | F)
+ *
+ * @param   void
+ *
+ * @return  unsigned char
+ */
+unsigned char HD44780_GetFunctionSet (void)
+{
+  // no bus traffic
+  return HD44780_FuncSet;
 }
 
 /**
@@ -168,6 +427,108 @@ void HD44780_DrawString (char *str)
   }
 }
 
+#if HD44780_USE_RTL
+/**
+ * @desc    LCD draw string from right to left, from current position
+ *
+ * @param   char *
+ *
+ * @return  void
+ */
+void HD44780_DrawStringRTL (char *str)
+{
+  // previous entry mode, default if unknown
+  unsigned char mode = (HD44780_EntryMode == 0xFF) ? HD44780_ENTRY_MODE : HD44780_EntryMode;
+
+  // decrement
+  HD44780_WriteEntryMode(HD44780_ENTRY);
+  // draw string
+  HD44780_DrawString(str);
+  // restore entry mode, nothing sent if caller keeps decrement
+  HD44780_WriteEntryMode(mode);
+}
+
+/**
+ * @desc    LCD draw string right aligned, last char at x, y
+ *
+ * @param   char x of right edge
+ * @param   char y
+ * @param   char *
+ *
+ * @return  char
+ */
+char HD44780_DrawStringRight (char x, char y, char *str)
+{
+  // previous entry mode, default if unknown
+  unsigned char mode = (HD44780_EntryMode == 0xFF) ? HD44780_ENTRY_MODE : HD44780_EntryMode;
+  unsigned char i = 0;
+
+  // right edge
+  if (HD44780_PositionXY(x, y) == ERROR) {
+    return ERROR;
+  }
+  // end of string
+  while (str[i] != '\0') {
+    i++;
+  }
+  // decrement
+  HD44780_WriteEntryMode(HD44780_ENTRY);
+  // last char first
+  while (i) {
+    HD44780_SendData(str[--i]);
+  }
+  // restore entry mode
+  HD44780_WriteEntryMode(mode);
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    LCD draw number right aligned, least significant digit at x, y
+ *
+ * @param   char x of right edge
+ * @param   char y
+ * @param   long number
+ * @param   char width of field, padded by spaces {0 - no padding}
+ *
+ * @return  char
+ */
+char HD44780_DrawNumberRight (char x, char y, long number, char width)
+{
+  // previous entry mode, default if unknown
+  unsigned char mode = (HD44780_EntryMode == 0xFF) ? HD44780_ENTRY_MODE : HD44780_EntryMode;
+  unsigned long value = (number < 0) ? (0UL - (unsigned long) number) : (unsigned long) number;
+  char count = 0;
+
+  // right edge
+  if (HD44780_PositionXY(x, y) == ERROR) {
+    return ERROR;
+  }
+  // decrement
+  HD44780_WriteEntryMode(HD44780_ENTRY);
+  // digits from least significant, length is not needed
+  do {
+    HD44780_SendData('0' + (value % 10));
+    value /= 10;
+    count++;
+  } while (value);
+  // sign
+  if (number < 0) {
+    HD44780_SendData('-');
+    count++;
+  }
+  // clear rest of field
+  while (count < width) {
+    HD44780_SendData(' ');
+    count++;
+  }
+  // restore entry mode
+  HD44780_WriteEntryMode(mode);
+  // success
+  return SUCCESS;
+}
+#endif
+
 /**
  * @desc    Got to position x,y
  *
@@ -194,6 +555,7 @@ char HD44780_PositionXY (char x, char y)
   return 0;
 }
 
+#if HD44780_USE_SHIFT
 /**
  * @desc    Shift cursor / display to left / right
  *
@@ -239,6 +601,166 @@ char HD44780_Shift (char item, char direction)
   // success
   return 0;
 }
+#endif
+
+#if HD44780_USE_BF
+/**
+ * @desc    Read DDRAM address
+ *
+ * @param   void
+ *
+ * @return  unsigned char
+ */
+unsigned char HD44780_ReadAddress (void)
+{
+  // tADD > 4us - address counter is updated after BF cleared
+  _delay_us(5);
+  // address counter
+  return HD44780_ReadBFandAC() & 0x7F;
+}
+#endif
+
+#if HD44780_USE_SLEEP
+// panel supply off, bus accesses return at once
+unsigned char HD44780_PowerDown = 0;
+#endif
+
+#if HD44780_USE_CGRAM
+// CGRAM content sent to LCD
+unsigned char HD44780_CGRAMShadow[64];
+// CGRAM slots with known content (bit per slot)
+unsigned char HD44780_CGRAMValid = 0;
+
+
+/**
+ * @desc    Send CGRAM rows from address, shadow is updated
+ *
+ * @param   unsigned char address in CGRAM {0; 1; ... 63}
+ * @param   const unsigned char * rows
+ * @param   unsigned char count of rows
+ *
+ * @return  void
+ */
+static void HD44780_CGRAMSend (unsigned char address, const unsigned char *rows, unsigned char count)
+{
+  // set CGRAM address
+  HD44780_SendInstruction(HD44780_CGRAM | (address & 0x3F));
+  // rows, address auto increments
+  while (count--) {
+    HD44780_SendData(*rows);
+    HD44780_CGRAMShadow[address++ & 0x3F] = *rows++;
+  }
+}
+
+/**
+ * @desc    Load CGRAM rows, DDRAM address is kept
+ *
+ * @param   unsigned char address in CGRAM {0; 1; ... 63}
+ * @param   const unsigned char * rows
+ * @param   unsigned char count of rows
+ *
+ * @return  void
+ */
+void HD44780_CGRAMWrite (unsigned char address, const unsigned char *rows, unsigned char count)
+{
+  unsigned char ac;
+  unsigned char slot;
+
+  // DDRAM address to return to
+  ac = HD44780_ReadAddress();
+  // rows
+  HD44780_CGRAMSend(address, rows, count);
+  // slots written completely have known content
+  for (slot = (address + 7) >> 3; ((slot + 1) << 3) <= (address + count) && slot < 8; slot++) {
+    HD44780_CGRAMValid |= (1 << slot);
+  }
+  // back to DDRAM
+  HD44780_SendInstruction(HD44780_POSITION | ac);
+}
+
+/**
+ * @desc    Update adjacent CGRAM slots, only changed rows are sent,
+ *          runs may cross slot boundary, DDRAM address is kept
+ *
+ * @param   unsigned char first slot {0; 1; ... 7}
+ * @param   const unsigned char * 8 rows per slot
+ * @param   unsigned char count of slots
+ *
+ * @return  unsigned char count of sent bytes, set CGRAM and
+ *          restore DDRAM address included
+ */
+unsigned char HD44780_CGRAMUpdateSlots (unsigned char slot, const unsigned char *rows, unsigned char slots)
+{
+  unsigned char *shadow = &HD44780_CGRAMShadow[slot << 3];
+  unsigned char count = slots << 3;
+  unsigned char known = 0;
+  unsigned char sent = 0;
+  unsigned char ac = 0;
+  unsigned char first;
+  unsigned char last;
+  unsigned char i;
+
+  // rows of slots with unknown content always differ
+  for (i = 0; i < slots; i++) {
+    if (HD44780_CGRAMValid & (1 << (slot + i))) {
+      known |= (1 << i);
+    }
+  }
+  // loop through rows
+  i = 0;
+  while (i < count) {
+    // skip unchanged row
+    if ((known & (1 << (i >> 3))) && (rows[i] == shadow[i])) {
+      i++;
+      continue;
+    }
+    // DDRAM address to return to, read before first run
+    if (!sent) {
+      ac = HD44780_ReadAddress();
+    }
+    // run of changed rows, one unchanged row is cheaper to resend
+    first = i;
+    last = i;
+    for (i = first + 1; i < count; i++) {
+      if (!(known & (1 << (i >> 3))) || (rows[i] != shadow[i])) {
+        last = i;
+      } else if ((i - last) > 1) {
+        break;
+      }
+    }
+    // one set CGRAM address per run
+    HD44780_CGRAMSend((slot << 3) + first, &rows[first], last - first + 1);
+    sent += last - first + 2;
+    i = last + 1;
+  }
+  // all rows of slots are in shadow now
+  for (i = 0; i < slots; i++) {
+    HD44780_CGRAMValid |= (1 << (slot + i));
+  }
+  // back to DDRAM
+  if (sent) {
+    HD44780_SendInstruction(HD44780_POSITION | ac);
+    sent++;
+  }
+  // count of instructions and data bytes
+  return sent;
+}
+
+/**
+ * @desc    Update CGRAM slot, only changed rows are sent,
+ *          DDRAM address is kept
+ *
+ * @param   unsigned char slot {0; 1; ... 7}
+ * @param   const unsigned char * 8 rows
+ *
+ * @return  unsigned char count of sent bytes, set CGRAM and
+ *          restore DDRAM address included
+ */
+unsigned char HD44780_CGRAMUpdate (unsigned char slot, const unsigned char *rows)
+{
+  return HD44780_CGRAMUpdateSlots(slot, rows, 1);
+}
+#endif
 
 /**
  * @desc    LCD init - initialisation routine
@@ -253,16 +775,20 @@ void HD44780_Init (void)
   SETBIT(HD44780_DDR_E, HD44780_E);
   // set RS as output
   SETBIT(HD44780_DDR_RS, HD44780_RS);
+#if HD44780_USE_BF
   // set RW as output
   SETBIT(HD44780_DDR_RW, HD44780_RW);
+#endif
 
   // set DB7-DB4 as output
   HD44780_SetDDR_DATA4to7();
   
   // clear RS
   CLRBIT(HD44780_PORT_RS, HD44780_RS);
-  // clear RW
+#if HD44780_USE_BF
+  // clear RW, write only build has RW tied to GND
   CLRBIT(HD44780_PORT_RW, HD44780_RW);
+#endif
   // clear E
   CLRBIT(HD44780_PORT_E, HD44780_E);
 
@@ -271,8 +797,9 @@ void HD44780_Init (void)
 
   // Busy Flag (BF) cannot be checked in these instructions
   // ---------------------------------------------------------------------
-  // Initial sequence 0x30 - send 4 bits in 4 bit mode
-  HD44780_SendInstruction(HD44780_INIT_SEQ);
+  // Initial sequence 0x30 - send 4 bits in 4 bit mode,
+  // nibble stays on bus for next two strobes
+  HD44780_Send4bitsIn4bitMode(HD44780_INIT_SEQ);
   // delay > 4.1ms
   _delay_ms(5);
 
@@ -307,6 +834,7 @@ void HD44780_Init (void)
   HD44780_SendInstruction(HD44780_ENTRY_MODE);
 }
 
+#if HD44780_USE_BF && (HD44780_MODE == HD44780_4BIT_MODE)
 /**
  * @desc    Check Busy Flag (BF) in 4 bit mode
  *
@@ -327,6 +855,8 @@ void HD44780_CheckBFin4bitMode (void)
   CLRBIT(HD44780_PORT_RS, HD44780_RS);
   // set RW - read instruction
   SETBIT(HD44780_PORT_RW, HD44780_RW);
+  // tAS - RW set up before E rises
+  HD44780_DELAY_NS(HD44780_T_AS, HD44780_CYC_SBI);
 
   // test HIGH level on PIN DB7
   // after clear PIN DB7 should continue
@@ -343,29 +873,31 @@ void HD44780_CheckBFin4bitMode (void)
     // --------------------------------
     // Set E
     SETBIT(HD44780_PORT_E, HD44780_E);
-    // PWeh > 0.5us
-    _delay_us(0.5);
-    // read upper nibble (tDDR > 360ns)
+    // tDDR, PIN is synchronized one cycle later
+    HD44780_DELAY_CYCLES(HD44780_CYCLES(HD44780_T_DDR) + HD44780_CYC_SYNC);
+    // read upper nibble
     input = HD44780_PIN_DATA;
+    // rest of PWeh
+    HD44780_DELAY_NS(HD44780_T_PWEH, HD44780_CYCLES(HD44780_T_DDR) + HD44780_CYC_SYNC + HD44780_CYC_IN + HD44780_CYC_SBI);
     // Clear E
     CLRBIT(HD44780_PORT_E, HD44780_E);
-    // TcycE > 1000ns -> delay depends on PWeh delay time
-    // delay = TcycE - PWeh = 1000 - 500 = 500ns
-    _delay_us(0.5);
+    // TcycE - PWeh, next E rises immediately
+    HD44780_DELAY_NS(HD44780_T_CYCE - HD44780_T_PWEH, HD44780_CYC_SBI);
 
     // Read lower nibble
     // --------------------------------
     // Set E
     SETBIT(HD44780_PORT_E, HD44780_E);
-    // PWeh > 0.5us
-    _delay_us(0.5);
-    // read lower nibble (tDDR > 360ns)
+    // tDDR, PIN is synchronized one cycle later
+    HD44780_DELAY_CYCLES(HD44780_CYCLES(HD44780_T_DDR) + HD44780_CYC_SYNC);
+    // read lower nibble
     input |= HD44780_PIN_DATA >> 4;
+    // rest of PWeh
+    HD44780_DELAY_NS(HD44780_T_PWEH, HD44780_CYCLES(HD44780_T_DDR) + HD44780_CYC_SYNC + HD44780_CYC_IN + HD44780_CYC_SBI);
     // Clear E
     CLRBIT(HD44780_PORT_E, HD44780_E);
-    // TcycE > 1000ns -> delay depends on PWeh delay time
-    // delay = TcycE - PWeh = 1000 - 500 = 500ns
-    _delay_us(0.5);
+    // TcycE - PWeh, next E rises immediately
+    HD44780_DELAY_NS(HD44780_T_CYCE - HD44780_T_PWEH, HD44780_CYC_SBI);
 
     // check if DB7 is cleared
     if (!(input & (1 << HD44780_DATA7))) {
@@ -380,7 +912,80 @@ void HD44780_CheckBFin4bitMode (void)
   // set DB7-DB4 as output
   HD44780_SetDDR_DATA4to7();
 }
+#endif
+
+#if HD44780_USE_BF
+/**
+ * @desc    Read Busy Flag (BF) and Address Counter (AC) in 4 bit mode
+ *
+ * @param   void
+ *
+ * @return  unsigned char BF (bit 7) | AC (bits 6-0)
+ */
+unsigned char HD44780_ReadBFandAC (void)
+{
+  unsigned char input = 0;
+
+#if HD44780_USE_SLEEP
+  // unpowered panel, pull-ups would feed it and BF reads set
+  if (HD44780_PowerDown) {
+    return 0;
+  }
+#endif
+  // clear DB7-DB4 as input
+  HD44780_ClearDDR_DATA4to7();
+  // set pull-up resistors for DB7-DB4
+  HD44780_SetPORT_DATA4to7();
+
+  // clear RS
+  CLRBIT(HD44780_PORT_RS, HD44780_RS);
+  // set RW - read instruction
+  SETBIT(HD44780_PORT_RW, HD44780_RW);
+  // tAS - RW set up before E rises
+  HD44780_DELAY_NS(HD44780_T_AS, HD44780_CYC_SBI);
+
+  // Read upper nibble
+  // --------------------------------
+  // Set E
+  SETBIT(HD44780_PORT_E, HD44780_E);
+  // tDDR, PIN is synchronized one cycle later
+  HD44780_DELAY_CYCLES(HD44780_CYCLES(HD44780_T_DDR) + HD44780_CYC_SYNC);
+  // read upper nibble
+  input = HD44780_PIN_DATA & 0xF0;
+  // rest of PWeh
+  HD44780_DELAY_NS(HD44780_T_PWEH, HD44780_CYCLES(HD44780_T_DDR) + HD44780_CYC_SYNC + HD44780_CYC_IN + HD44780_CYC_SBI);
+  // Clear E
+  CLRBIT(HD44780_PORT_E, HD44780_E);
+  // TcycE - PWeh, next E rises immediately
+  HD44780_DELAY_NS(HD44780_T_CYCE - HD44780_T_PWEH, HD44780_CYC_SBI);
+
+  // Read lower nibble
+  // --------------------------------
+  // Set E
+  SETBIT(HD44780_PORT_E, HD44780_E);
+  // tDDR, PIN is synchronized one cycle later
+  HD44780_DELAY_CYCLES(HD44780_CYCLES(HD44780_T_DDR) + HD44780_CYC_SYNC);
+  // read lower nibble
+  input |= HD44780_PIN_DATA >> 4;
+  // rest of PWeh
+  HD44780_DELAY_NS(HD44780_T_PWEH, HD44780_CYCLES(HD44780_T_DDR) + HD44780_CYC_SYNC + HD44780_CYC_IN + HD44780_CYC_SBI);
+  // Clear E
+  CLRBIT(HD44780_PORT_E, HD44780_E);
+  // TcycE - PWeh, next E is preceded by DDR set up
+  HD44780_DELAY_NS(HD44780_T_CYCE - HD44780_T_PWEH, HD44780_CYC_NIBBLE);
+
+  // clear RW
+  CLRBIT(HD44780_PORT_RW, HD44780_RW);
+
+  // set DB7-DB4 as output
+  HD44780_SetDDR_DATA4to7();
+
+  // BF | AC
+  return input;
+}
+#endif
 
+#if HD44780_USE_BF && (HD44780_MODE == HD44780_8BIT_MODE)
 /**
  * @desc    Check Busy Flag (BF) in 8 bit mode
  *
@@ -390,6 +995,36 @@ void HD44780_CheckBFin4bitMode (void)
 void HD44780_CheckBFin8bitMode (void)
 {
 }
+#endif
+
+/**
+ * @desc    Wait for execution of instruction / data write,
+ *          busy flag or timed delay
+ *
+ * @param   unsigned char instruction, data write as set address
+ *
+ * @return  void
+ */
+static void HD44780_WaitExec (unsigned char instruction)
+{
+#if HD44780_USE_BF && (HD44780_MODE == HD44780_4BIT_MODE)
+  // check busy flag
+  (void) instruction;
+  HD44780_CheckBFin4bitMode();
+#elif HD44780_USE_BF
+  // check busy flag
+  (void) instruction;
+  HD44780_CheckBFin8bitMode();
+#else
+  // clear display, return home
+  if (instruction < HD44780_ENTRY) {
+    _delay_us(HD44780_T_EXEC_LONG);
+  // other instructions, data write
+  } else {
+    _delay_us(HD44780_T_EXEC);
+  }
+#endif
+}
 
 /**
  * @desc    LCD send instruction
@@ -400,24 +1035,30 @@ void HD44780_CheckBFin8bitMode (void)
  */
 void HD44780_SendInstruction (unsigned short int data)
 {
+#if HD44780_USE_SLEEP
+  // unpowered panel, busy flag would never clear
+  if (HD44780_PowerDown) {
+    return;
+  }
+#endif
+  // cache registers
+  HD44780_CacheUpdate(data);
+
   // Clear RS
-  HD44780_PORT_RS &= ~(1 << HD44780_RS);
+  CLRBIT(HD44780_PORT_RS, HD44780_RS);
 
-  // 4bit mode
-  // ------------------------------------------
-  if (HD44780_MODE == HD44780_4BIT_MODE) {
-    // send required data in required mode
-    HD44780_Send8bitsIn4bitMode(data);
-    // check busy flag
-    HD44780_CheckBFin4bitMode();
-  // 8 bit mode
-  // ------------------------------------------
-  } else if (HD44780_MODE == HD44780_8BIT_MODE) {
-    // send required data in required mode
-    HD44780_Send8bitsIn8bitMode(data);
-    // check busy flag
-    HD44780_CheckBFin8bitMode();
-  }
+  // send required data in required mode
+#if HD44780_MODE == HD44780_4BIT_MODE
+  HD44780_Send8bitsIn4bitMode(data);
+#else
+  HD44780_Send8bitsIn8bitMode(data);
+#endif
+#if HD44780_USE_TRACE
+  // byte strobed out
+  HD44780_TraceStrobe();
+#endif
+  // wait for execution
+  HD44780_WaitExec(data);
 }
 
 /**
@@ -429,24 +1070,29 @@ void HD44780_SendInstruction (unsigned short int data)
  */
 void HD44780_SendData (unsigned short int data)
 {
+#if HD44780_USE_SLEEP
+  // unpowered panel, busy flag would never clear
+  if (HD44780_PowerDown) {
+    return;
+  }
+#endif
   // Set RS
   SETBIT(HD44780_PORT_RS, HD44780_RS);
 
-  // 4bit mode
-  // ------------------------------------------
-  if (HD44780_MODE == HD44780_4BIT_MODE) {
-    // send required data in required mode
-    HD44780_Send8bitsIn4bitMode(data);
-    // check busy flag
-    HD44780_CheckBFin4bitMode();
-  // 8 bit mode
-  // ------------------------------------------
-  } else if (HD44780_MODE == HD44780_8BIT_MODE) {
-    // send required data in required mode
-    HD44780_Send8bitsIn8bitMode(data);
-    // check busy flag
-    HD44780_CheckBFin8bitMode();
-  }
+  // send required data in required mode
+#if HD44780_MODE == HD44780_4BIT_MODE
+  HD44780_Send8bitsIn4bitMode(data);
+#else
+  HD44780_Send8bitsIn8bitMode(data);
+#endif
+#if HD44780_USE_TRACE
+  // byte strobed out
+  HD44780_TraceStrobe();
+#endif
+  // wait for execution
+  HD44780_WaitExec(HD44780_POSITION);
+  // address counter moved
+  HD44780_CacheData();
 
   // Clear RS
   CLRBIT(HD44780_PORT_RS, HD44780_RS); 
@@ -461,19 +1107,19 @@ void HD44780_SendData (unsigned short int data)
  */
 void HD44780_Send4bitsIn4bitMode (unsigned short int data)
 {
+  // send data to LCD, set up before E rises
+  HD44780_SetUppNibble(data);
   // Set E
   SETBIT(HD44780_PORT_E, HD44780_E);
-  // send data to LCD
-  HD44780_SetUppNibble(data);
-  // PWeh delay time > 450ns
-  _delay_us(0.5);
+  // PWeh, clear E is spent in pulse
+  HD44780_DELAY_NS(HD44780_T_PWEH, HD44780_CYC_SBI);
   // Clear E
   CLRBIT(HD44780_PORT_E, HD44780_E);
-  // TcycE > 1000ns -> delay depends on PWeh delay time
-  // delay = TcycE - PWeh = 1000 - 500 = 500ns
-  _delay_us(0.5);
+  // TcycE - PWeh, next E may rise immediately (HD44780_PulseE)
+  HD44780_DELAY_NS(HD44780_T_CYCE - HD44780_T_PWEH, HD44780_CYC_SBI);
 }
 
+#if HD44780_MODE == HD44780_4BIT_MODE
 /**
  * @desc    LCD send 8bits instruction in 4 bit mode
  *
@@ -485,33 +1131,33 @@ void HD44780_Send8bitsIn4bitMode (unsigned short int data)
 {
   // Send upper nibble
   // ----------------------------------
+  // send data to LCD, set up before E rises
+  HD44780_SetUppNibble(data);
   // Set E
   SETBIT(HD44780_PORT_E, HD44780_E);
-  // send data to LCD
-  HD44780_SetUppNibble(data);
-  // PWeh delay time > 450ns
-  _delay_us(0.5);
+  // PWeh, clear E is spent in pulse
+  HD44780_DELAY_NS(HD44780_T_PWEH, HD44780_CYC_SBI);
   // Clear E
   CLRBIT(HD44780_PORT_E, HD44780_E);
-  // TcycE > 1000ns -> delay depends on PWeh delay time
-  // delay = TcycE - PWeh = 1000 - 500 = 500ns
-  _delay_us(0.5);
+  // TcycE - PWeh, lower nibble set up is spent
+  HD44780_DELAY_NS(HD44780_T_CYCE - HD44780_T_PWEH, HD44780_CYC_NIBBLE);
 
   // Send lower nibble
   // ----------------------------------
+  // send data to LCD, set up before E rises
+  HD44780_SetUppNibble(data << 4);
   // Set E
   SETBIT(HD44780_PORT_E, HD44780_E);
-  // send data to LCD
-  HD44780_SetUppNibble(data << 4);
-  // PWeh delay time > 450ns
-  _delay_us(0.5);
+  // PWeh, clear E is spent in pulse
+  HD44780_DELAY_NS(HD44780_T_PWEH, HD44780_CYC_SBI);
   // Clear E
   CLRBIT(HD44780_PORT_E, HD44780_E);
-  // TcycE > 1000ns -> delay depends on PWeh delay time
-  // delay = TcycE - PWeh = 1000 - 500 = 500ns
-  _delay_us(0.5);
+  // TcycE - PWeh, next E is preceded by nibble or DDR set up
+  HD44780_DELAY_NS(HD44780_T_CYCE - HD44780_T_PWEH, HD44780_CYC_NIBBLE);
 }
+#endif
 
+#if HD44780_MODE == HD44780_8BIT_MODE
 /**
  * @desc    LCD send 8bits instruction in 8 bit mode
  *
@@ -521,20 +1167,20 @@ void HD44780_Send8bitsIn4bitMode (unsigned short int data)
  */
 void HD44780_Send8bitsIn8bitMode (unsigned short int data)
 {
-  // Set E
-  SETBIT(HD44780_PORT_E, HD44780_E);
-  // send data to LCD
+  // send data to LCD, set up before E rises
   HD44780_SetUppNibble(data);
   // send data to LCD
   HD44780_SetLowNibble(data);
-  // PWeh delay time > 450ns
-  _delay_us(0.5);
+  // Set E
+  SETBIT(HD44780_PORT_E, HD44780_E);
+  // PWeh, clear E is spent in pulse
+  HD44780_DELAY_NS(HD44780_T_PWEH, HD44780_CYC_SBI);
   // Clear E
   CLRBIT(HD44780_PORT_E, HD44780_E);
-  // TcycE > 1000ns -> delay depends on PWeh delay time
-  // delay = TcycE - PWeh = 1000 - 500 = 500ns
-  _delay_us(0.5);
+  // TcycE - PWeh, next E is preceded by nibble or DDR set up
+  HD44780_DELAY_NS(HD44780_T_CYCE - HD44780_T_PWEH, HD44780_CYC_NIBBLE);
 }
+#endif
 
 /**
  * @desc    LCD send upper nibble
@@ -557,6 +1203,7 @@ void HD44780_SetUppNibble (unsigned short int data)
   if (data & 0x10) { SETBIT(HD44780_PORT_DATA, HD44780_DATA4); }
 }
 
+#if HD44780_MODE == HD44780_8BIT_MODE
 /**
  * @desc    LCD send lower nibble
  *
@@ -577,6 +1224,7 @@ void HD44780_SetLowNibble (unsigned short int data)
   if (data & 0x02) { SETBIT(HD44780_PORT_DATA, HD44780_DATA1); }
   if (data & 0x01) { SETBIT(HD44780_PORT_DATA, HD44780_DATA0); }
 }
+#endif
 
 /**
  * @desc    LCD pulse E
@@ -589,15 +1237,15 @@ void HD44780_PulseE (void)
 {
   // Set E
   SETBIT(HD44780_PORT_E, HD44780_E);
-  // PWeh delay time > 450ns
-  _delay_us(0.5);
+  // PWeh, clear E is spent in pulse
+  HD44780_DELAY_NS(HD44780_T_PWEH, HD44780_CYC_SBI);
   // Clear E
   CLRBIT(HD44780_PORT_E, HD44780_E);
-  // TcycE > 1000ns -> delay depends on PWeh delay time
-  // delay = TcycE - PWeh = 1000 - 500 = 500ns
-  _delay_us(0.5);
+  // TcycE - PWeh, next E may rise immediately
+  HD44780_DELAY_NS(HD44780_T_CYCE - HD44780_T_PWEH, HD44780_CYC_SBI);
 }
 
+#if HD44780_USE_BF
 /**
  * @desc    Set PORT DB4 to DB7
  *
@@ -613,7 +1261,9 @@ void HD44780_SetPORT_DATA4to7 (void)
   SETBIT(HD44780_PORT_DATA, HD44780_DATA6);
   SETBIT(HD44780_PORT_DATA, HD44780_DATA7);
 }
+#endif
 
+#if HD44780_USE_BF
 /**
  * @desc    Clear DDR DB4 to DB7
  *
@@ -629,6 +1279,7 @@ void HD44780_ClearDDR_DATA4to7 (void)
   CLRBIT(HD44780_DDR_DATA, HD44780_DATA6);
   CLRBIT(HD44780_DDR_DATA, HD44780_DATA7);
 }
+#endif
 
 /**
  * @desc    Set DDR DB4 to DB7
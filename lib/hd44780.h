@@ -30,13 +30,61 @@
   #endif 
 
   // define clock
-  #if defined(__AVR_ATmega8__)
+  #if defined(F_CPU)
+    #define _FCPU F_CPU
+  #elif defined(__AVR_ATmega8__)
     #define _FCPU 8000000
   #elif defined(__AVR_ATmega16__)
     #define _FCPU 16000000
   #endif
 
-  #if defined(__AVR_ATmega16__)
+  // timing characteristics [ns], VCC = 2.7 to 4.5 V
+  // --------------------------------------
+  #ifndef HD44780_T_AS
+    #define HD44780_T_AS        60    // address set-up time RS, RW -> E
+  #endif
+  #ifndef HD44780_T_PWEH
+    #define HD44780_T_PWEH      450   // enable pulse width (high level)
+  #endif
+  #ifndef HD44780_T_CYCE
+    #define HD44780_T_CYCE      1000  // enable cycle time
+  #endif
+  #ifndef HD44780_T_DDR
+    #define HD44780_T_DDR       360   // data delay time (read)
+  #endif
+  #ifndef HD44780_T_H
+    #define HD44780_T_H         10    // data hold time (write)
+  #endif
+
+  // instruction cycles spent between E edges
+  // --------------------------------------
+  // sbi / cbi, pin changes at the end of instruction
+  #define HD44780_CYC_SBI       2
+  // in - read PIN register
+  #define HD44780_CYC_IN        1
+  // latency of PIN input synchronizer
+  #define HD44780_CYC_SYNC      1
+  // lower bound of nibble set up before E rises (4x cbi DB7-DB4 + sbi E),
+  // every E strobe in driver is preceded by nibble or DDR set up
+  #define HD44780_CYC_NIBBLE    (5 * HD44780_CYC_SBI)
+
+  // cycles of time [ns] rounded up
+  #define HD44780_CYCLES(ns)    ((((unsigned long) (ns)) * (_FCPU / 1000UL) + 999999UL) / 1000000UL)
+  // padding cycles, cycles spent by instructions are subtracted
+  #define HD44780_PAD(ns, spent) ((HD44780_CYCLES(ns) > (spent)) ? (HD44780_CYCLES(ns) - (spent)) : 0)
+  #if defined(HD44780_LINUX)
+    // pins and delays through GPIO layer of Linux port
+    #include "hd44780_gpio.h"
+    // delay cycles of virtual clock _FCPU
+    #define HD44780_DELAY_CYCLES(cycles) { if ((cycles) > 0) { HD44780_GpioDelay(cycles); } }
+  #else
+    // delay cycles computed at compile time
+    #define HD44780_DELAY_CYCLES(cycles) { if ((cycles) > 0) { __builtin_avr_delay_cycles(cycles); } }
+  #endif
+  // delay time [ns] reduced by cycles already spent
+  #define HD44780_DELAY_NS(ns, spent) HD44780_DELAY_CYCLES(HD44780_PAD(ns, spent))
+
+  #if defined(__AVR_ATmega16__) || defined(HD44780_LINUX)
 
     // E port
     // --------------------------------------
@@ -138,6 +186,16 @@
   #define HD44780_FONT_5x8        0x00
   #define HD44780_FONT_5x10       0x04
   #define HD44780_POSITION        0x80
+  #define HD44780_CGRAM           0x40
+
+  #define HD44780_ENTRY           0x04
+  #define HD44780_ENTRY_INC       0x02
+  #define HD44780_ENTRY_SHIFT     0x01
+  #define HD44780_DISP_CTRL       0x08
+  #define HD44780_DISP_D          0x04
+  #define HD44780_DISP_C          0x02
+  #define HD44780_DISP_B          0x01
+  #define HD44780_FUNCTION        0x20
 
   #define HD44780_SHIFT           0x10
   #define HD44780_CURSOR          0x00
@@ -152,6 +210,10 @@
   #define HD44780_ROW1_END        HD44780_COLS
   #define HD44780_ROW2_START      0x40
   #define HD44780_ROW2_END        HD44780_COLS
+  #define HD44780_ROW3_START      0x14
+  #define HD44780_ROW3_END        HD44780_COLS
+  #define HD44780_ROW4_START      0x54
+  #define HD44780_ROW4_END        HD44780_COLS
 
   // **********************************************
   //                      !!!
@@ -163,12 +225,113 @@
   //  HD44780_8BIT_MODE - 8 bit mode / 8 data wires    
   //
   // **********************************************
-  #define HD44780_MODE            HD44780_4BIT_MODE
+  #ifndef HD44780_MODE
+    #define HD44780_MODE          HD44780_4BIT_MODE
+  #endif
+
+  // **********************************************
+  //                      !!!
+  //      BUILD PROFILE - CORRECTLY DEFINED
+  //
+  // ----------------------------------------------
+  //
+  //  HD44780_PROFILE_MINIMAL - write only timed text, RW tied
+  //                            to GND, no busy flag / address reads
+  //  HD44780_PROFILE_TEXT    - text with busy flag, cursor control
+  //  HD44780_PROFILE_FULL    - all functions
+  //
+  //  features follow profile, each can be overridden,
+  //  functions of disabled features are not compiled
+  //
+  // **********************************************
+  #define HD44780_PROFILE_MINIMAL 0
+  #define HD44780_PROFILE_TEXT    1
+  #define HD44780_PROFILE_FULL    2
+  #ifndef HD44780_PROFILE
+    #define HD44780_PROFILE       HD44780_PROFILE_FULL
+  #endif
+
+  // busy flag and address counter reads, timed waits if 0
+  #ifndef HD44780_USE_BF
+    #define HD44780_USE_BF        (HD44780_PROFILE >= HD44780_PROFILE_TEXT)
+  #endif
+  // cursor and blink (HD44780_Cursor*, HD44780_SetCursor, HD44780_SetBlink)
+  #ifndef HD44780_USE_CURSOR
+    #define HD44780_USE_CURSOR    (HD44780_PROFILE >= HD44780_PROFILE_TEXT)
+  #endif
+  // cursor / display shift (HD44780_Shift)
+  #ifndef HD44780_USE_SHIFT
+    #define HD44780_USE_SHIFT     (HD44780_PROFILE >= HD44780_PROFILE_FULL)
+  #endif
+  // right to left drawing (HD44780_DrawStringRTL, HD44780_Draw*Right)
+  #ifndef HD44780_USE_RTL
+    #define HD44780_USE_RTL       (HD44780_PROFILE >= HD44780_PROFILE_FULL)
+  #endif
+  // CGRAM with shadow (HD44780_CGRAMWrite, HD44780_CGRAMUpdate*)
+  #ifndef HD44780_USE_CGRAM
+    #define HD44780_USE_CGRAM     (HD44780_PROFILE >= HD44780_PROFILE_FULL)
+  #endif
+  // panel power gating, bus accesses dropped while powered down (hd44780_sleep.h)
+  #ifndef HD44780_USE_SLEEP
+    #define HD44780_USE_SLEEP     (HD44780_PROFILE >= HD44780_PROFILE_FULL)
+  #endif
+  // latency tracing, bytes stamped by HD44780_TraceStrobe (hd44780_trace.h)
+  #ifndef HD44780_USE_TRACE
+    #define HD44780_USE_TRACE     0
+  #endif
+
+  #if HD44780_USE_CGRAM && !HD44780_USE_BF
+    #error "HD44780_USE_CGRAM requires HD44780_USE_BF (address counter read)"
+  #endif
+
+  // execution times [us] of timed waits without busy flag
+  // --------------------------------------
+  #ifndef HD44780_T_EXEC
+    #define HD44780_T_EXEC        50    // 37 us + tADD 4 us, fosc 250 kHz
+  #endif
+  #ifndef HD44780_T_EXEC_LONG
+    #define HD44780_T_EXEC_LONG   1650  // clear display, return home
+  #endif
+
+  // **********************************************
+  //                      !!!
+  //      CHARACTER ROM - CORRECTLY DEFINED
+  //
+  // ----------------------------------------------
+  //
+  //  HD44780_ROM_A00 - Japanese standard font
+  //  HD44780_ROM_A02 - European standard font
+  //
+  // **********************************************
+  #define HD44780_ROM_A00         0
+  #define HD44780_ROM_A02         2
+  #ifndef HD44780_ROM
+    #define HD44780_ROM           HD44780_ROM_A00
+  #endif
   
-  // set bit
-  #define SETBIT(REG, BIT)        { REG |= (1 << BIT); }
-  // clear bit
-  #define CLRBIT(REG, BIT)        { REG &= ~(1 << BIT); }
+  #if HD44780_USE_CGRAM
+  // CGRAM content sent to LCD
+  extern unsigned char HD44780_CGRAMShadow[64];
+  // CGRAM slots with known content (bit per slot)
+  extern unsigned char HD44780_CGRAMValid;
+  #endif
+
+  #if HD44780_USE_SLEEP
+  // panel supply off (hd44780_sleep), bus accesses return at once
+  extern unsigned char HD44780_PowerDown;
+  #endif
+
+  #if defined(HD44780_LINUX)
+    // set bit, pin is driven by GPIO layer
+    #define SETBIT(REG, BIT)      { HD44780_GpioWrite(&(REG), BIT, 1); }
+    // clear bit, pin is driven by GPIO layer
+    #define CLRBIT(REG, BIT)      { HD44780_GpioWrite(&(REG), BIT, 0); }
+  #else
+    // set bit
+    #define SETBIT(REG, BIT)      { REG |= (1 << BIT); }
+    // clear bit
+    #define CLRBIT(REG, BIT)      { REG &= ~(1 << BIT); }
+  #endif
   // set port / pin if bit is set
   #define SET_IF_BIT_IS_SET(REG, PORT, DATA, BIT) { if((DATA & BIT) > 0) { SETBIT(REG, PORT); } }
   
@@ -199,6 +362,16 @@
    */
   void HD44780_DisplayOn (void);
 
+  /**
+   * @desc    LCD display off, DDRAM content is kept
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_DisplayOff (void);
+
+  #if HD44780_USE_CURSOR
   /**
    * @desc    LCD cursor on, display on
    *
@@ -225,6 +398,101 @@
    * @return  void
    */
   void HD44780_CursorBlink (void);
+  #endif
+
+  /**
+   * @desc    LCD display on / off, cursor and blink are kept
+   *
+   * @param   char {0; 1}
+   *
+   * @return  void
+   */
+  void HD44780_SetDisplay (char);
+
+  #if HD44780_USE_CURSOR
+  /**
+   * @desc    LCD cursor on / off, display and blink are kept
+   *
+   * @param   char {0; 1}
+   *
+   * @return  void
+   */
+  void HD44780_SetCursor (char);
+
+  /**
+   * @desc    LCD blink on / off, display and cursor are kept
+   *
+   * @param   char {0; 1}
+   *
+   * @return  void
+   */
+  void HD44780_SetBlink (char);
+  #endif
+
+  /**
+   * @desc    LCD entry mode, instruction is sent only if mode changes
+   *
+   * @param   char increment {1 - increment; 0 - decrement}
+   * @param   char shift {1 - shift display; 0 - no shift}
+   *
+   * @return  void
+   */
+  void HD44780_SetEntryMode (char, char);
+
+  /**
+   * @desc    Get cached display control register (0x08 | D | C | B)
+   *
+   * @param   void
+   *
+   * @return  unsigned char
+   */
+  unsigned char HD44780_GetDisplayControl (void);
+
+  /**
+   * @desc    Get cached entry mode register (0x04 | I/D | S)
+   *
+   * @param   void
+   *
+   * @return  unsigned char
+   */
+  unsigned char HD44780_GetEntryMode (void);
+
+  /**
+   * @desc    Get cached function set register (0x20 | DL | N | F)
+   *
+   * @param   void
+   *
+   * @return  unsigned char
+   */
+  unsigned char HD44780_GetFunctionSet (void);
+
+  /**
+   * @desc    Update register cache by instruction sent to LCD
+   *
+   * @param   unsigned char
+   *
+   * @return  void
+   */
+  void HD44780_CacheUpdate (unsigned char);
+
+  /**
+   * @desc    Update cached address counter by data write,
+   *          moves by I/D of cached entry mode
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_CacheData (void);
+
+  /**
+   * @desc    Get cached DDRAM address counter, no bus traffic
+   *
+   * @param   void
+   *
+   * @return  unsigned char address, 0xFF if unknown
+   */
+  unsigned char HD44780_GetAddress (void);
 
   /**
    * @desc    LCD draw char
@@ -243,6 +511,40 @@
    */
   void HD44780_DrawString (char *str);
 
+  #if HD44780_USE_RTL
+  /**
+   * @desc    LCD draw string from right to left, from current position
+   *
+   * @param   char *
+   *
+   * @return  void
+   */
+  void HD44780_DrawStringRTL (char *);
+
+  /**
+   * @desc    LCD draw string right aligned, last char at x, y
+   *
+   * @param   char x of right edge
+   * @param   char y
+   * @param   char *
+   *
+   * @return  char
+   */
+  char HD44780_DrawStringRight (char, char, char *);
+
+  /**
+   * @desc    LCD draw number right aligned, least significant digit at x, y
+   *
+   * @param   char x of right edge
+   * @param   char y
+   * @param   long number
+   * @param   char width of field, padded by spaces {0 - no padding}
+   *
+   * @return  char
+   */
+  char HD44780_DrawNumberRight (char, char, long, char);
+  #endif
+
   /**
    * @desc    Got to position x,y
    *
@@ -253,6 +555,7 @@
    */
   char HD44780_PositionXY (char x, char y);
 
+  #if HD44780_USE_SHIFT
   /**
    * @desc    Shift cursor / display to left / right
    *
@@ -262,7 +565,67 @@
    * @return  char
    */
   char HD44780_Shift (char item, char direction);
+  #endif
+
+  #if HD44780_USE_CGRAM
+  /**
+   * @desc    Load CGRAM rows, DDRAM address is kept
+   *
+   * @param   unsigned char address in CGRAM {0; 1; ... 63}
+   * @param   const unsigned char * rows
+   * @param   unsigned char count of rows
+   *
+   * @return  void
+   */
+  void HD44780_CGRAMWrite (unsigned char, const unsigned char *, unsigned char);
+
+  /**
+   * @desc    Update CGRAM slot, only changed rows are sent,
+   *          DDRAM address is kept
+   *
+   * @param   unsigned char slot {0; 1; ... 7}
+   * @param   const unsigned char * 8 rows
+   *
+   * @return  unsigned char count of sent bytes, set CGRAM and
+   *          restore DDRAM address included
+   */
+  unsigned char HD44780_CGRAMUpdate (unsigned char, const unsigned char *);
+
+  /**
+   * @desc    Update adjacent CGRAM slots, only changed rows are sent,
+   *          runs may cross slot boundary, DDRAM address is kept
+   *
+   * @param   unsigned char first slot {0; 1; ... 7}
+   * @param   const unsigned char * 8 rows per slot
+   * @param   unsigned char count of slots
+   *
+   * @return  unsigned char count of sent bytes, set CGRAM and
+   *          restore DDRAM address included
+   */
+  unsigned char HD44780_CGRAMUpdateSlots (unsigned char, const unsigned char *, unsigned char);
+  #endif
+
+  #if HD44780_USE_BF
+  /**
+   * @desc    Read Busy Flag (BF) and Address Counter (AC) in 4 bit mode
+   *
+   * @param   void
+   *
+   * @return  unsigned char BF (bit 7) | AC (bits 6-0)
+   */
+  unsigned char HD44780_ReadBFandAC (void);
+
+  /**
+   * @desc    Read DDRAM address
+   *
+   * @param   void
+   *
+   * @return  unsigned char
+   */
+  unsigned char HD44780_ReadAddress (void);
+  #endif
 
+  #if HD44780_USE_BF && (HD44780_MODE == HD44780_8BIT_MODE)
   /**
    * @desc    Check Busy Flag (BF) in 8 bit mode
    *
@@ -271,7 +634,9 @@
    * @return  void
    */
   void HD44780_CheckBFin8bitMode (void);
+  #endif
 
+  #if HD44780_USE_BF && (HD44780_MODE == HD44780_4BIT_MODE)
   /**
    * @desc    Check Busy Flag (BF) in 4 bit mode
    *
@@ -280,6 +645,7 @@
    * @return  void
    */
   void HD44780_CheckBFin4bitMode (void);
+  #endif
 
   /**
    * @desc    LCD send instruction
@@ -308,6 +674,7 @@
    */
   void HD44780_Send4bitsIn4bitMode (unsigned short int);
 
+  #if HD44780_MODE == HD44780_4BIT_MODE
   /**
    * @desc    LCD send 8bits instruction in 4 bit mode
    *
@@ -316,7 +683,9 @@
    * @return  void
    */
   void HD44780_Send8bitsIn4bitMode (unsigned short int);
+  #endif
 
+  #if HD44780_MODE == HD44780_8BIT_MODE
   /**
    * @desc    LCD send 8bits instruction in 8 bit mode
    *
@@ -325,6 +694,7 @@
    * @return  void
    */
   void HD44780_Send8bitsIn8bitMode (unsigned short int);
+  #endif
 
   /**
    * @desc    LCD send upper nibble
@@ -335,6 +705,7 @@
    */
   void HD44780_SetUppNibble (unsigned short int);
 
+  #if HD44780_MODE == HD44780_8BIT_MODE
   /**
    * @desc    LCD send lower nibble
    *
@@ -343,6 +714,7 @@
    * @return  void
    */
   void HD44780_SetLowNibble (unsigned short int);
+  #endif
 
   /**
    * @desc    LCD pulse E
@@ -353,6 +725,7 @@
    */
   void HD44780_PulseE (void);
 
+  #if HD44780_USE_BF
   /**
    * @desc    Set PORT DB4 to DB7
    *
@@ -361,6 +734,7 @@
    * @return  void
    */
   void HD44780_SetPORT_DATA4to7 (void);
+  #endif
 
   /**
    * @desc    Set DDR DB4 to DB7
@@ -371,6 +745,7 @@
    */
   void HD44780_SetDDR_DATA4to7 (void);
 
+  #if HD44780_USE_BF
   /**
    * @desc    Clear DDR DB4 to DB7
    *
@@ -379,5 +754,6 @@
    * @return  void
    */
   void HD44780_ClearDDR_DATA4to7 (void);
+  #endif
 
 #endif
@@ -0,0 +1,341 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Command Batching
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_batch.c
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_shadow.h, hd44780_batch.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#include "hd44780.h"
+#include "hd44780_shadow.h"
+#include "hd44780_batch.h"
+
+// data flag of buffer entry
+#define HD44780_BATCH_DATA        0x100
+// address counter unknown (set address instruction has bit 7 or 6 set)
+#define HD44780_BATCH_NOADDR      0x00
+
+// instruction types
+#define HD44780_IS_DISPCTRL(c)    (((c) & 0xF8) == HD44780_DISP_OFF)
+#define HD44780_IS_ENTRY(c)       (((c) & 0xFC) == 0x04)
+#define HD44780_IS_SHIFT(c)       (((c) & 0xF0) == HD44780_SHIFT)
+#define HD44780_IS_ADDRESS(c)     ((c) & (HD44780_POSITION | HD44780_CGRAM))
+
+// buffer of instructions and data
+static unsigned short int HD44780_Batch[HD44780_BATCH_SIZE];
+// count of entries
+static unsigned char HD44780_BatchCount = 0;
+// set address instruction matching address counter
+static unsigned char HD44780_BatchAddr = HD44780_BATCH_NOADDR;
+// address counter after last data write, clear or home
+static unsigned char HD44780_BatchBase = HD44780_BATCH_NOADDR;
+// address counter step of data write
+static signed char HD44780_BatchStep = 1;
+
+/**
+ * @desc    Batch remove entry
+ *
+ * @param   unsigned char index
+ *
+ * @return  void
+ */
+static void HD44780_BatchRemove (unsigned char index)
+{
+  // shift rest of buffer
+  while (++index < HD44780_BatchCount) {
+    HD44780_Batch[index - 1] = HD44780_Batch[index];
+  }
+  // one entry less
+  HD44780_BatchCount--;
+}
+
+/**
+ * @desc    Batch append entry, full buffer is sent
+ *
+ * @param   unsigned short int
+ *
+ * @return  void
+ */
+static void HD44780_BatchAppend (unsigned short int entry)
+{
+  // full buffer
+  if (HD44780_BatchCount >= HD44780_BATCH_SIZE) {
+    HD44780_BatchCommit();
+  }
+  // store
+  HD44780_Batch[HD44780_BatchCount++] = entry;
+}
+
+/**
+ * @desc    Batch move tracked address counter
+ *
+ * @param   signed char step
+ *
+ * @return  void
+ */
+static void HD44780_BatchMove (signed char step)
+{
+  unsigned char address;
+
+  // unknown
+  if (HD44780_BatchAddr == HD44780_BATCH_NOADDR) {
+    return;
+  }
+  // DDRAM
+  if (HD44780_BatchAddr & HD44780_POSITION) {
+    address = (HD44780_BatchAddr & 0x7F) + step;
+    // line end wraps to other line, keep it unknown
+    if ((address & 0x3F) >= 0x28) {
+      HD44780_BatchAddr = HD44780_BATCH_NOADDR;
+    } else {
+      HD44780_BatchAddr = HD44780_POSITION | (address & 0x7F);
+    }
+  // CGRAM wraps around 64 bytes
+  } else {
+    HD44780_BatchAddr = HD44780_CGRAM | ((HD44780_BatchAddr + step) & 0x3F);
+  }
+}
+
+/**
+ * @desc    Batch begin - clear buffer
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_BatchBegin (void)
+{
+  // empty buffer
+  HD44780_BatchCount = 0;
+  // address counter not known
+  HD44780_BatchAddr = HD44780_BATCH_NOADDR;
+  HD44780_BatchBase = HD44780_BATCH_NOADDR;
+  // entry mode from cache, increment if unknown
+  HD44780_BatchStep = (HD44780_GetEntryMode() & HD44780_ENTRY_INC) ? 1 : -1;
+}
+
+/**
+ * @desc    Batch instruction
+ *
+ * @param   unsigned char
+ *
+ * @return  void
+ */
+void HD44780_BatchInstruction (unsigned char instruction)
+{
+  unsigned short int entry;
+  unsigned char base;
+  unsigned char i;
+
+  // display control - directly preceding one is replaced, earlier ones
+  // stay (e.g. display off while drawing, then on)
+  if (HD44780_IS_DISPCTRL(instruction)) {
+    if (HD44780_BatchCount) {
+      entry = HD44780_Batch[HD44780_BatchCount - 1];
+      if (!(entry & HD44780_BATCH_DATA) && HD44780_IS_DISPCTRL(entry)) {
+        HD44780_BatchCount--;
+      }
+    }
+    HD44780_BatchAppend(instruction);
+    return;
+  }
+
+  // entry mode - earlier one without data write in between is dropped
+  if (HD44780_IS_ENTRY(instruction)) {
+    for (i = HD44780_BatchCount; i-- > 0; ) {
+      entry = HD44780_Batch[i];
+      if (entry & HD44780_BATCH_DATA) {
+        break;
+      }
+      if (HD44780_IS_ENTRY(entry)) {
+        HD44780_BatchRemove(i);
+        break;
+      }
+    }
+    // direction of address counter
+    HD44780_BatchStep = (instruction & 0x02) ? 1 : -1;
+    HD44780_BatchAppend(instruction);
+    return;
+  }
+
+  // set DDRAM / CGRAM address
+  if (HD44780_IS_ADDRESS(instruction)) {
+    // address counter is already there
+    if (instruction == HD44780_BatchAddr) {
+      return;
+    }
+    // set address and cursor shift overwritten before data write
+    base = 1;
+    for (i = HD44780_BatchCount; i-- > 0; ) {
+      entry = HD44780_Batch[i];
+      // data write uses address
+      if (entry & HD44780_BATCH_DATA) {
+        break;
+      }
+      // overwritten
+      if (HD44780_IS_ADDRESS(entry) || (HD44780_IS_SHIFT(entry) && !(entry & HD44780_DISPLAY))) {
+        HD44780_BatchRemove(i);
+        continue;
+      }
+      // address counter not affected
+      if (HD44780_IS_DISPCTRL(entry) || HD44780_IS_ENTRY(entry)) {
+        continue;
+      }
+      // clear, home - address counter equals base
+      if ((entry & 0xFC) == 0) {
+        break;
+      }
+      // display shift, function set - moves before it stay
+      base = 0;
+      break;
+    }
+    // all moves since last data write are dropped
+    if (base) {
+      HD44780_BatchAddr = HD44780_BatchBase;
+      // address counter is back where required
+      if (instruction == HD44780_BatchAddr) {
+        return;
+      }
+    }
+    HD44780_BatchAddr = instruction;
+    HD44780_BatchAppend(instruction);
+    return;
+  }
+
+  // cursor / display shift
+  if (HD44780_IS_SHIFT(instruction)) {
+    // opposite shift of the same item cancels previous one
+    if (HD44780_BatchCount) {
+      entry = HD44780_Batch[HD44780_BatchCount - 1];
+      if (!(entry & HD44780_BATCH_DATA) && HD44780_IS_SHIFT(entry) && (((entry ^ instruction) & 0x0C) == HD44780_RIGHT)) {
+        HD44780_BatchCount--;
+        // cursor returns
+        if (!(instruction & HD44780_DISPLAY)) {
+          HD44780_BatchMove((instruction & HD44780_RIGHT) ? 1 : -1);
+        }
+        return;
+      }
+    }
+    // cursor shift moves address counter
+    if (!(instruction & HD44780_DISPLAY)) {
+      HD44780_BatchMove((instruction & HD44780_RIGHT) ? 1 : -1);
+    }
+    HD44780_BatchAppend(instruction);
+    return;
+  }
+
+  // display clear - address 0, entry mode increment
+  if (instruction == HD44780_DISP_CLEAR) {
+    HD44780_BatchAddr = HD44780_POSITION;
+    HD44780_BatchBase = HD44780_POSITION;
+    HD44780_BatchStep = 1;
+  // return home - address 0
+  } else if ((instruction & 0xFE) == HD44780_RETURN_HOME) {
+    HD44780_BatchAddr = HD44780_POSITION;
+    HD44780_BatchBase = HD44780_POSITION;
+  }
+  // function set and others as they are
+  HD44780_BatchAppend(instruction);
+}
+
+/**
+ * @desc    Batch data
+ *
+ * @param   unsigned char
+ *
+ * @return  void
+ */
+void HD44780_BatchData (unsigned char data)
+{
+  // store
+  HD44780_BatchAppend(HD44780_BATCH_DATA | data);
+  // address auto increments / decrements
+  HD44780_BatchMove(HD44780_BatchStep);
+  // set address before data write can not be dropped anymore
+  HD44780_BatchBase = HD44780_BatchAddr;
+}
+
+/**
+ * @desc    Batch go to position x, y
+ *
+ * @param   unsigned char x
+ * @param   unsigned char y
+ *
+ * @return  char
+ */
+char HD44780_BatchPositionXY (unsigned char x, unsigned char y)
+{
+  // check position
+  if ((x >= HD44780_COLS) || (y >= HD44780_ROWS)) {
+    // error
+    return ERROR;
+  }
+  // set DDRAM address
+  HD44780_BatchInstruction(HD44780_POSITION | HD44780_ShadowAddress(x, y));
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Batch string
+ *
+ * @param   char *
+ *
+ * @return  void
+ */
+void HD44780_BatchString (char *str)
+{
+  unsigned char i = 0;
+
+  // loop through string
+  while (str[i] != '\0') {
+    HD44780_BatchData(str[i++]);
+  }
+}
+
+/**
+ * @desc    Batch commit - send buffer as one stream
+ *
+ * @param   void
+ *
+ * @return  unsigned char count of sent bytes
+ */
+unsigned char HD44780_BatchCommit (void)
+{
+  unsigned short int entry;
+  unsigned char sent = 0;
+  unsigned char i;
+
+  // loop through buffer
+  for (i = 0; i < HD44780_BatchCount; i++) {
+    entry = HD44780_Batch[i];
+    // data
+    if (entry & HD44780_BATCH_DATA) {
+      HD44780_SendData(entry & 0xFF);
+    // registers already in required state
+    } else if ((HD44780_IS_DISPCTRL(entry) && (entry == HD44780_GetDisplayControl())) ||
+               (HD44780_IS_ENTRY(entry) && (entry == HD44780_GetEntryMode()))) {
+      continue;
+    // instruction
+    } else {
+      HD44780_SendInstruction(entry);
+    }
+    sent++;
+  }
+  // empty buffer, address counter tracking continues
+  HD44780_BatchCount = 0;
+  // sent moves can not be dropped, address counter is new base
+  HD44780_BatchBase = HD44780_BatchAddr;
+  // count of sent bytes
+  return sent;
+}
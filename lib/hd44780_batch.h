@@ -0,0 +1,89 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Command Batching
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_batch.h
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h
+ * ---------------------------------------------------------------+
+ * @usage       instructions and data are collected in buffer and
+ *              optimized when appended:
+ *              - adjacent display controls merged into final state
+ *              - entry modes without data write between merged
+ *              - set address overwritten before data write dropped
+ *              - set address to current address counter dropped
+ *              - opposite shifts cancelled
+ *              HD44780_BatchCommit sends the result as one stream
+ */
+#ifndef __HD44780_BATCH_H__
+#define __HD44780_BATCH_H__
+
+  #include "hd44780.h"
+
+  // size of batch buffer, full buffer is sent automatically
+  #ifndef HD44780_BATCH_SIZE
+    #define HD44780_BATCH_SIZE    32
+  #endif
+
+  /**
+   * @desc    Batch begin - clear buffer
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_BatchBegin (void);
+
+  /**
+   * @desc    Batch instruction
+   *
+   * @param   unsigned char
+   *
+   * @return  void
+   */
+  void HD44780_BatchInstruction (unsigned char);
+
+  /**
+   * @desc    Batch data
+   *
+   * @param   unsigned char
+   *
+   * @return  void
+   */
+  void HD44780_BatchData (unsigned char);
+
+  /**
+   * @desc    Batch go to position x, y
+   *
+   * @param   unsigned char x
+   * @param   unsigned char y
+   *
+   * @return  char
+   */
+  char HD44780_BatchPositionXY (unsigned char, unsigned char);
+
+  /**
+   * @desc    Batch string
+   *
+   * @param   char *
+   *
+   * @return  void
+   */
+  void HD44780_BatchString (char *);
+
+  /**
+   * @desc    Batch commit - send buffer as one stream
+   *
+   * @param   void
+   *
+   * @return  unsigned char count of sent bytes
+   */
+  unsigned char HD44780_BatchCommit (void);
+
+#endif
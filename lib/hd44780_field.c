@@ -0,0 +1,142 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Numeric Field Widgets
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_field.c
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_shadow.h, hd44780_field.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#include "hd44780.h"
+#include "hd44780_shadow.h"
+#include "hd44780_field.h"
+
+/**
+ * @desc    Field render value into cells, right aligned
+ *
+ * @param   HD44780_Field *
+ * @param   long value
+ * @param   char * cells
+ *
+ * @return  void
+ */
+static void HD44780_FieldRender (HD44780_Field *field, long number, char *cells)
+{
+  unsigned long value = (number < 0) ? (0UL - (unsigned long) number) : (unsigned long) number;
+  unsigned char sign = (number < 0) || (field->flags & HD44780_FIELD_PLUS);
+  unsigned char digits = 0;
+  unsigned char pos = field->width;
+
+  // digits from least significant, at least one before decimal point
+  do {
+    // overflow
+    if (pos == 0) {
+      break;
+    }
+    cells[--pos] = '0' + (value % 10);
+    value /= 10;
+    digits++;
+    // decimal point
+    if ((digits == field->decimals) && pos) {
+      cells[--pos] = '.';
+    }
+  } while (value || (digits <= field->decimals));
+
+  // leading zeros up to sign
+  if (field->flags & HD44780_FIELD_ZERO) {
+    while (pos > sign) {
+      cells[--pos] = '0';
+    }
+  }
+  // value or sign does not fit
+  if ((value || (digits <= field->decimals)) || (sign && (pos == 0))) {
+    for (pos = 0; pos < field->width; pos++) {
+      cells[pos] = HD44780_FIELD_OVERFLOW;
+    }
+    return;
+  }
+  // sign
+  if (sign) {
+    cells[--pos] = (number < 0) ? '-' : '+';
+  }
+  // spaces
+  while (pos) {
+    cells[--pos] = ' ';
+  }
+}
+
+/**
+ * @desc    Field init, content is unknown until first update
+ *
+ * @param   HD44780_Field *
+ * @param   unsigned char x
+ * @param   unsigned char y
+ * @param   unsigned char width
+ * @param   unsigned char decimals
+ * @param   unsigned char flags
+ *
+ * @return  char ERROR if out of display or widget table full
+ */
+char HD44780_FieldInit (HD44780_Field *field, unsigned char x, unsigned char y, unsigned char width, unsigned char decimals, unsigned char flags)
+{
+  // check position and width
+  if ((width == 0) || ((x + width) > HD44780_COLS) || (y >= HD44780_ROWS) || (decimals >= width)) {
+    // error
+    return ERROR;
+  }
+  // field
+  field->x = x;
+  field->y = y;
+  field->width = width;
+  field->decimals = decimals;
+  field->flags = flags;
+  // not drawn yet
+  HD44780_FieldInvalidate(field);
+  // cells reset by shadow reset (display clear, wake)
+  return HD44780_ShadowRegister(field->cells, width);
+}
+
+/**
+ * @desc    Field invalidate, next update sends all cells
+ *          (e.g. after HD44780_DisplayClear)
+ *
+ * @param   HD44780_Field *
+ *
+ * @return  void
+ */
+void HD44780_FieldInvalidate (HD44780_Field *field)
+{
+  unsigned char i;
+
+  // rendered chars are never 0
+  for (i = 0; i < field->width; i++) {
+    field->cells[i] = 0;
+  }
+}
+
+/**
+ * @desc    Field update, value is right aligned
+ *
+ * @param   HD44780_Field *
+ * @param   long value, decimals are last digits (215 -> 21.5)
+ *
+ * @return  unsigned char count of sent bytes
+ */
+unsigned char HD44780_FieldUpdate (HD44780_Field *field, long value)
+{
+  char cells[HD44780_COLS];
+
+  // new content
+  HD44780_FieldRender(field, value, cells);
+  // changed runs only
+  return HD44780_ShadowSend(field->x, field->y, cells, field->cells, field->width);
+}
@@ -0,0 +1,77 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Numeric Field Widgets
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_field.h
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_shadow.h
+ * ---------------------------------------------------------------+
+ * @usage       field keeps rendered cells, on update only changed
+ *              cells are sent, one set address per changed run
+ *              (e.g. 1009 -> 1010 sends set address + 2 data bytes)
+ */
+#ifndef __HD44780_FIELD_H__
+#define __HD44780_FIELD_H__
+
+  #include "hd44780.h"
+
+  // char of field if value does not fit
+  #ifndef HD44780_FIELD_OVERFLOW
+    #define HD44780_FIELD_OVERFLOW '#'
+  #endif
+
+  // flags
+  #define HD44780_FIELD_ZERO      0x01  // leading zeros instead of spaces
+  #define HD44780_FIELD_PLUS      0x02  // sign of positive value
+
+  // numeric field
+  typedef struct {
+    unsigned char x;                // left column
+    unsigned char y;                // row
+    unsigned char width;            // count of cells
+    unsigned char decimals;         // digits after decimal point
+    unsigned char flags;            // HD44780_FIELD_*
+    char cells[HD44780_COLS];       // rendered content, 0 unknown
+  } HD44780_Field;
+
+  /**
+   * @desc    Field init, content is unknown until first update
+   *
+   * @param   HD44780_Field *
+   * @param   unsigned char x
+   * @param   unsigned char y
+   * @param   unsigned char width
+   * @param   unsigned char decimals
+   * @param   unsigned char flags
+   *
+   * @return  char ERROR if out of display or widget table full
+   */
+  char HD44780_FieldInit (HD44780_Field *, unsigned char, unsigned char, unsigned char, unsigned char, unsigned char);
+
+  /**
+   * @desc    Field invalidate, next update sends all cells
+   *          (e.g. after HD44780_DisplayClear)
+   *
+   * @param   HD44780_Field *
+   *
+   * @return  void
+   */
+  void HD44780_FieldInvalidate (HD44780_Field *);
+
+  /**
+   * @desc    Field update, value is right aligned
+   *
+   * @param   HD44780_Field *
+   * @param   long value, decimals are last digits (215 -> 21.5)
+   *
+   * @return  unsigned char count of sent bytes
+   */
+  unsigned char HD44780_FieldUpdate (HD44780_Field *, long);
+
+#endif
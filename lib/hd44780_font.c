@@ -0,0 +1,115 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 CGRAM Font Packs
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_font.c
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_font.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#include <avr/pgmspace.h>
+#include "hd44780.h"
+#include "hd44780_font.h"
+
+// bars - 4 glyphs, 1 byte each (32 bytes raw)
+const unsigned char HD44780_FontBars[] PROGMEM = {
+  HD44780_FONT_RLE, 0, 4,
+  0xF0,   // 8x 10000
+  0xF8,   // 8x 11000
+  0xFC,   // 8x 11100
+  0xFE    // 8x 11110
+};
+
+// big digits - 3 glyphs, 2-3 bytes each (24 bytes raw)
+const unsigned char HD44780_FontDigits[] PROGMEM = {
+  HD44780_FONT_RLE, 4, 3,
+  0x3F, 0xA0,         // 2x 11111, 6x 00000
+  0xA0, 0x3F,         // 6x 00000, 2x 11111
+  0x3F, 0x60, 0x3F    // 2x 11111, 4x 00000, 2x 11111
+};
+
+// icons - 8 glyphs, 5 bytes each (64 bytes raw)
+const unsigned char HD44780_FontIcons[] PROGMEM = {
+  HD44780_FONT_PACKED, 0, 8,
+  0x23, 0x9C, 0xEF, 0x80, 0x80,   // bell
+  0x02, 0xBF, 0xF7, 0x10, 0x00,   // heart
+  0x76, 0xE3, 0x1F, 0xFF, 0xE0,   // battery
+  0x74, 0x63, 0xFD, 0xEF, 0xE0,   // lock
+  0x22, 0x94, 0xE7, 0x7F, 0xEE,   // thermometer
+  0x00, 0x47, 0x6E, 0x20, 0x00,   // check
+  0x64, 0xA4, 0xC0, 0x00, 0x00,   // degree
+  0x03, 0xAB, 0x78, 0xB8, 0x00    // clock
+};
+
+/**
+ * @desc    Font pack load, nothing is sent if CGRAM already
+ *          holds the pack, DDRAM address is kept
+ *
+ * @param   const unsigned char * pack in flash
+ *
+ * @return  unsigned char count of sent rows
+ */
+unsigned char HD44780_FontLoad (const unsigned char *pack)
+{
+  const unsigned char *data = pack + HD44780_FONT_HEADER;
+  unsigned char format = pgm_read_byte(&pack[0]);
+  unsigned char start = pgm_read_byte(&pack[1]) << 3;
+  unsigned char end = start + (pgm_read_byte(&pack[2]) << 3);
+  unsigned char first = 0xFF;
+  unsigned char last = 0;
+  unsigned char run = 0;
+  unsigned char row = 0;
+  unsigned short int bits;
+  unsigned short int offset = 0;
+  unsigned char i;
+
+  // check slots
+  if ((start >= end) || (end > 64)) {
+    return 0;
+  }
+  // decompress rows into shadow
+  for (i = start; i < end; i++) {
+    // 5 bit packed, row may cross byte boundary
+    if (format == HD44780_FONT_PACKED) {
+      bits = pgm_read_byte(&data[offset >> 3]) << 8;
+      if ((offset & 7) > 3) {
+        bits |= pgm_read_byte(&data[(offset >> 3) + 1]);
+      }
+      row = (bits >> (11 - (offset & 7))) & 0x1F;
+      offset += 5;
+    // run length, runs may cross glyphs
+    } else {
+      if (run == 0) {
+        bits = pgm_read_byte(&data[offset++]);
+        run = (bits >> 5) + 1;
+        row = bits & 0x1F;
+      }
+      run--;
+    }
+    // row of unknown slot or changed row
+    if (!(HD44780_CGRAMValid & (1 << (i >> 3))) || (HD44780_CGRAMShadow[i] != row)) {
+      HD44780_CGRAMShadow[i] = row;
+      if (first == 0xFF) {
+        first = i;
+      }
+      last = i;
+    }
+  }
+  // pack already loaded
+  if (first == 0xFF) {
+    return 0;
+  }
+  // changed range with one set CGRAM address, unknown slots are whole
+  HD44780_CGRAMWrite(first, &HD44780_CGRAMShadow[first], last - first + 1);
+  // count of sent rows
+  return last - first + 1;
+}
@@ -0,0 +1,82 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 CGRAM Font Packs
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_font.h
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h
+ * ---------------------------------------------------------------+
+ * @usage       font pack in flash:
+ *              - byte 0   format {HD44780_FONT_PACKED; HD44780_FONT_RLE}
+ *              - byte 1   first CGRAM slot
+ *              - byte 2   count of glyphs
+ *              - rows     HD44780_FONT_PACKED 5 bits per row, MSB first
+ *                         (5 bytes per glyph)
+ *                         HD44780_FONT_RLE byte per run of equal rows,
+ *                         bits 7-5 run length - 1, bits 4-0 row
+ *              pack is decompressed on the fly into CGRAM shadow,
+ *              changed rows are sent with one set CGRAM address
+ */
+#ifndef __HD44780_FONT_H__
+#define __HD44780_FONT_H__
+
+  #include "hd44780.h"
+
+  #if !HD44780_USE_CGRAM
+    #error "hd44780_font requires HD44780_USE_CGRAM"
+  #endif
+
+  // formats of rows
+  #define HD44780_FONT_PACKED     0
+  #define HD44780_FONT_RLE        1
+
+  // size of header
+  #define HD44780_FONT_HEADER     3
+
+  // bars pack - slots 0-3, 1-4 left columns lit,
+  // full block is ROM char 0xFF
+  #define HD44780_BAR_1           0
+  #define HD44780_BAR_2           1
+  #define HD44780_BAR_3           2
+  #define HD44780_BAR_4           3
+  #define HD44780_BAR_FULL        0xFF
+
+  // big digits pack - slots 4-6, 2 rows lit on top, bottom or
+  // both, vertical strokes are ROM char 0xFF (fits next to bars)
+  #define HD44780_DIGIT_TOP       4
+  #define HD44780_DIGIT_BOTTOM    5
+  #define HD44780_DIGIT_BOTH      6
+  #define HD44780_DIGIT_FULL      0xFF
+
+  // icons pack - slots 0-7
+  #define HD44780_ICON_BELL       0
+  #define HD44780_ICON_HEART      1
+  #define HD44780_ICON_BATTERY    2
+  #define HD44780_ICON_LOCK       3
+  #define HD44780_ICON_THERMO     4
+  #define HD44780_ICON_CHECK      5
+  #define HD44780_ICON_DEGREE     6
+  #define HD44780_ICON_CLOCK      7
+
+  // built-in packs
+  extern const unsigned char HD44780_FontBars[];
+  extern const unsigned char HD44780_FontDigits[];
+  extern const unsigned char HD44780_FontIcons[];
+
+  /**
+   * @desc    Font pack load, nothing is sent if CGRAM already
+   *          holds the pack, DDRAM address is kept
+   *
+   * @param   const unsigned char * pack in flash
+   *
+   * @return  unsigned char count of sent rows
+   */
+  unsigned char HD44780_FontLoad (const unsigned char *);
+
+#endif
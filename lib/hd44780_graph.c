@@ -0,0 +1,237 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Bar Graph and Big Digits
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_graph.c
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_shadow.h, hd44780_font.h, hd44780_graph.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#include <avr/pgmspace.h>
+#include "hd44780.h"
+#include "hd44780_shadow.h"
+#include "hd44780_font.h"
+#include "hd44780_graph.h"
+
+// big digit cells, upper row then lower row
+static const unsigned char HD44780_BigGlyphs[10][6] PROGMEM = {
+  // 0
+  { HD44780_DIGIT_FULL, HD44780_DIGIT_TOP, HD44780_DIGIT_FULL,
+    HD44780_DIGIT_FULL, HD44780_DIGIT_BOTTOM, HD44780_DIGIT_FULL },
+  // 1
+  { HD44780_DIGIT_TOP, HD44780_DIGIT_FULL, ' ',
+    HD44780_DIGIT_BOTTOM, HD44780_DIGIT_FULL, HD44780_DIGIT_BOTTOM },
+  // 2
+  { HD44780_DIGIT_BOTH, HD44780_DIGIT_BOTH, HD44780_DIGIT_FULL,
+    HD44780_DIGIT_FULL, HD44780_DIGIT_BOTTOM, HD44780_DIGIT_BOTTOM },
+  // 3
+  { HD44780_DIGIT_BOTH, HD44780_DIGIT_BOTH, HD44780_DIGIT_FULL,
+    HD44780_DIGIT_BOTTOM, HD44780_DIGIT_BOTTOM, HD44780_DIGIT_FULL },
+  // 4
+  { HD44780_DIGIT_FULL, HD44780_DIGIT_BOTTOM, HD44780_DIGIT_FULL,
+    ' ', ' ', HD44780_DIGIT_FULL },
+  // 5
+  { HD44780_DIGIT_FULL, HD44780_DIGIT_BOTH, HD44780_DIGIT_BOTH,
+    HD44780_DIGIT_BOTTOM, HD44780_DIGIT_BOTTOM, HD44780_DIGIT_FULL },
+  // 6
+  { HD44780_DIGIT_FULL, HD44780_DIGIT_BOTH, HD44780_DIGIT_BOTH,
+    HD44780_DIGIT_FULL, HD44780_DIGIT_BOTTOM, HD44780_DIGIT_FULL },
+  // 7
+  { HD44780_DIGIT_TOP, HD44780_DIGIT_TOP, HD44780_DIGIT_FULL,
+    ' ', ' ', HD44780_DIGIT_FULL },
+  // 8
+  { HD44780_DIGIT_FULL, HD44780_DIGIT_BOTH, HD44780_DIGIT_FULL,
+    HD44780_DIGIT_FULL, HD44780_DIGIT_BOTTOM, HD44780_DIGIT_FULL },
+  // 9
+  { HD44780_DIGIT_FULL, HD44780_DIGIT_BOTH, HD44780_DIGIT_FULL,
+    HD44780_DIGIT_BOTTOM, HD44780_DIGIT_BOTTOM, HD44780_DIGIT_FULL }
+};
+
+/**
+ * @desc    Bar init, loads bars pack, content is unknown until
+ *          first update
+ *
+ * @param   HD44780_Bar *
+ * @param   unsigned char x
+ * @param   unsigned char y
+ * @param   unsigned char width in cells
+ *
+ * @return  char ERROR if out of display or widget table full
+ */
+char HD44780_BarInit (HD44780_Bar *bar, unsigned char x, unsigned char y, unsigned char width)
+{
+  // check position and width, pixels fit in byte
+  if ((width == 0) || ((x + width) > HD44780_COLS) || (y >= HD44780_ROWS) || (width > (255 / HD44780_BAR_PIXELS))) {
+    // error
+    return ERROR;
+  }
+  // bar
+  bar->x = x;
+  bar->y = y;
+  bar->width = width;
+  // partial blocks, nothing sent if loaded
+  HD44780_FontLoad(HD44780_FontBars);
+  // not drawn yet
+  HD44780_BarInvalidate(bar);
+  // cells reset by shadow reset (display clear, wake)
+  return HD44780_ShadowRegister((char *) bar->cells, width);
+}
+
+/**
+ * @desc    Bar invalidate, next update sends all cells
+ *          (e.g. after HD44780_DisplayClear)
+ *
+ * @param   HD44780_Bar *
+ *
+ * @return  void
+ */
+void HD44780_BarInvalidate (HD44780_Bar *bar)
+{
+  unsigned char i;
+
+  // unknown cells differ from any rendered
+  for (i = 0; i < bar->width; i++) {
+    bar->cells[i] = HD44780_GRAPH_UNKNOWN;
+  }
+}
+
+/**
+ * @desc    Bar update
+ *
+ * @param   HD44780_Bar *
+ * @param   unsigned char pixels {0; 1; ... width * 5}, clamped
+ *
+ * @return  unsigned char count of sent bytes
+ */
+unsigned char HD44780_BarUpdate (HD44780_Bar *bar, unsigned char pixels)
+{
+  unsigned char cells[HD44780_COLS];
+  unsigned char i;
+
+  // render, full cells - partial cell - empty cells
+  for (i = 0; i < bar->width; i++) {
+    // full block
+    if (pixels >= HD44780_BAR_PIXELS) {
+      cells[i] = HD44780_BAR_FULL;
+      pixels -= HD44780_BAR_PIXELS;
+    // partial block, bars pack slots 0-3 = 1-4 pixels
+    } else if (pixels) {
+      cells[i] = HD44780_BAR_1 + pixels - 1;
+      pixels = 0;
+    // empty
+    } else {
+      cells[i] = ' ';
+    }
+  }
+  // changed cells only
+  return HD44780_ShadowSend(bar->x, bar->y, (const char *) cells, (char *) bar->cells, bar->width);
+}
+
+/**
+ * @desc    Big digits init, loads big digits pack, content is
+ *          unknown until first update
+ *
+ * @param   HD44780_Big *
+ * @param   unsigned char x
+ * @param   unsigned char y upper row
+ * @param   unsigned char count of digits
+ *
+ * @return  char ERROR if out of display or widget table full
+ */
+char HD44780_BigInit (HD44780_Big *big, unsigned char x, unsigned char y, unsigned char digits)
+{
+  // check position and count, no space after last digit
+  if ((digits == 0) || ((x + digits * HD44780_BIG_CELLS - 1) > HD44780_COLS) || ((y + 1) >= HD44780_ROWS)) {
+    // error
+    return ERROR;
+  }
+  // big digits
+  big->x = x;
+  big->y = y;
+  big->digits = digits;
+  // segment glyphs, nothing sent if loaded
+  HD44780_FontLoad(HD44780_FontDigits);
+  // not drawn yet
+  HD44780_BigInvalidate(big);
+  // cells of both rows reset by shadow reset (display clear, wake)
+  if (HD44780_ShadowRegister((char *) big->cells[0], digits * HD44780_BIG_CELLS - 1) == ERROR) {
+    // error
+    return ERROR;
+  }
+  return HD44780_ShadowRegister((char *) big->cells[1], digits * HD44780_BIG_CELLS - 1);
+}
+
+/**
+ * @desc    Big digits invalidate, next update sends all cells
+ *          (e.g. after HD44780_DisplayClear)
+ *
+ * @param   HD44780_Big *
+ *
+ * @return  void
+ */
+void HD44780_BigInvalidate (HD44780_Big *big)
+{
+  unsigned char i;
+
+  // unknown cells differ from any rendered
+  for (i = 0; i < (big->digits * HD44780_BIG_CELLS - 1); i++) {
+    big->cells[0][i] = HD44780_GRAPH_UNKNOWN;
+    big->cells[1][i] = HD44780_GRAPH_UNKNOWN;
+  }
+}
+
+/**
+ * @desc    Big digits update, right aligned, leading zeros blank,
+ *          higher digits than fit are dropped
+ *
+ * @param   HD44780_Big *
+ * @param   unsigned long value
+ *
+ * @return  unsigned char count of sent bytes
+ */
+unsigned char HD44780_BigUpdate (HD44780_Big *big, unsigned long value)
+{
+  unsigned char cells[2][HD44780_COLS];
+  unsigned char width = big->digits * HD44780_BIG_CELLS - 1;
+  unsigned char digit;
+  unsigned char pos;
+  unsigned char i;
+  unsigned char j;
+
+  // digits from least significant
+  for (i = big->digits; i > 0; i--) {
+    pos = (i - 1) * HD44780_BIG_CELLS;
+    // space between digits
+    if (i < big->digits) {
+      cells[0][pos + 3] = ' ';
+      cells[1][pos + 3] = ' ';
+    }
+    // leading zero blank, last digit always drawn
+    if ((value == 0) && (i < big->digits)) {
+      for (j = 0; j < 3; j++) {
+        cells[0][pos + j] = ' ';
+        cells[1][pos + j] = ' ';
+      }
+      continue;
+    }
+    // digit glyph cells
+    digit = value % 10;
+    value /= 10;
+    for (j = 0; j < 3; j++) {
+      cells[0][pos + j] = pgm_read_byte(&HD44780_BigGlyphs[digit][j]);
+      cells[1][pos + j] = pgm_read_byte(&HD44780_BigGlyphs[digit][j + 3]);
+    }
+  }
+  // changed cells of both rows
+  return HD44780_ShadowSend(big->x, big->y, (const char *) cells[0], (char *) big->cells[0], width) +
+         HD44780_ShadowSend(big->x, big->y + 1, (const char *) cells[1], (char *) big->cells[1], width);
+}
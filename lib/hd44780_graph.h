@@ -0,0 +1,127 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Bar Graph and Big Digits
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_graph.h
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_font.h
+ * ---------------------------------------------------------------+
+ * @usage       renderers keep drawn cells, on update only changed
+ *              cells are sent, set address is skipped when cached
+ *              address counter already points at the cell
+ *              - bar     5 pixels per cell, bars pack in slots 0-3,
+ *                        1 pixel move = 1 changed cell, growing into
+ *                        next cell continues at address counter
+ *                        (1 data byte), move inside cell rewrites
+ *                        cell behind counter (set address + data)
+ *              - big     digits 3x2 cells + 1 column space, big
+ *                        digits pack in slots 4-6
+ *              packs are loaded on init (nothing sent if loaded),
+ *              do not load icons pack over them
+ */
+#ifndef __HD44780_GRAPH_H__
+#define __HD44780_GRAPH_H__
+
+  #include "hd44780.h"
+
+  #if !HD44780_USE_CGRAM
+    #error "hd44780_graph requires HD44780_USE_CGRAM"
+  #endif
+
+  // pixels per cell
+  #define HD44780_BAR_PIXELS      5
+  // cells of one big digit with space
+  #define HD44780_BIG_CELLS       4
+  // drawn cell not known, never rendered
+  #define HD44780_GRAPH_UNKNOWN   0x7F
+
+  // horizontal bar graph
+  typedef struct {
+    unsigned char x;                // left column
+    unsigned char y;                // row
+    unsigned char width;            // count of cells
+    unsigned char cells[HD44780_COLS];  // drawn content
+  } HD44780_Bar;
+
+  // big digits number
+  typedef struct {
+    unsigned char x;                // left column
+    unsigned char y;                // upper row
+    unsigned char digits;           // count of digits
+    unsigned char cells[2][HD44780_COLS]; // drawn content
+  } HD44780_Big;
+
+  /**
+   * @desc    Bar init, loads bars pack, content is unknown until
+   *          first update
+   *
+   * @param   HD44780_Bar *
+   * @param   unsigned char x
+   * @param   unsigned char y
+   * @param   unsigned char width in cells
+   *
+   * @return  char ERROR if out of display or widget table full
+   */
+  char HD44780_BarInit (HD44780_Bar *, unsigned char, unsigned char, unsigned char);
+
+  /**
+   * @desc    Bar invalidate, next update sends all cells
+   *          (e.g. after HD44780_DisplayClear)
+   *
+   * @param   HD44780_Bar *
+   *
+   * @return  void
+   */
+  void HD44780_BarInvalidate (HD44780_Bar *);
+
+  /**
+   * @desc    Bar update
+   *
+   * @param   HD44780_Bar *
+   * @param   unsigned char pixels {0; 1; ... width * 5}, clamped
+   *
+   * @return  unsigned char count of sent bytes
+   */
+  unsigned char HD44780_BarUpdate (HD44780_Bar *, unsigned char);
+
+  /**
+   * @desc    Big digits init, loads big digits pack, content is
+   *          unknown until first update
+   *
+   * @param   HD44780_Big *
+   * @param   unsigned char x
+   * @param   unsigned char y upper row
+   * @param   unsigned char count of digits
+   *
+   * @return  char ERROR if out of display or widget table full
+   */
+  char HD44780_BigInit (HD44780_Big *, unsigned char, unsigned char, unsigned char);
+
+  /**
+   * @desc    Big digits invalidate, next update sends all cells
+   *          (e.g. after HD44780_DisplayClear)
+   *
+   * @param   HD44780_Big *
+   *
+   * @return  void
+   */
+  void HD44780_BigInvalidate (HD44780_Big *);
+
+  /**
+   * @desc    Big digits update, right aligned, leading zeros blank,
+   *          higher digits than fit are dropped
+   *
+   * @param   HD44780_Big *
+   * @param   unsigned long value
+   *
+   * @return  unsigned char count of sent bytes
+   */
+  unsigned char HD44780_BigUpdate (HD44780_Big *, unsigned long);
+
+#endif
@@ -0,0 +1,381 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Bit-Sliced Drive of Several Displays
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_multi.c
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_multi.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 4 displays 16x2 LCD
+ */
+
+// include libraries
+#include <util/delay.h>
+#include <avr/io.h>
+#include "hd44780.h"
+#include "hd44780_multi.h"
+
+/**
+ * @desc    Write port words of data lines, bits of other
+ *          displays are kept
+ *
+ * @param   const unsigned char * words DB4-DB7
+ *
+ * @return  void
+ */
+static void HD44780_MultiWrite (const unsigned char *words)
+{
+  // one write per data line
+  HD44780_MULTI_PORT_DB4 = (HD44780_MULTI_PORT_DB4 & (unsigned char) ~HD44780_MULTI_MASK) | words[0];
+  HD44780_MULTI_PORT_DB5 = (HD44780_MULTI_PORT_DB5 & (unsigned char) ~HD44780_MULTI_MASK) | words[1];
+  HD44780_MULTI_PORT_DB6 = (HD44780_MULTI_PORT_DB6 & (unsigned char) ~HD44780_MULTI_MASK) | words[2];
+  HD44780_MULTI_PORT_DB7 = (HD44780_MULTI_PORT_DB7 & (unsigned char) ~HD44780_MULTI_MASK) | words[3];
+}
+
+/**
+ * @desc    Write same nibble to all displays, line is all ones
+ *          or all zeros
+ *
+ * @param   unsigned char nibble (bits 3-0)
+ *
+ * @return  void
+ */
+static void HD44780_MultiWriteNibble (unsigned char nibble)
+{
+  unsigned char words[4];
+
+  // no transpose
+  words[0] = (nibble & 0x01) ? HD44780_MULTI_MASK : 0;
+  words[1] = (nibble & 0x02) ? HD44780_MULTI_MASK : 0;
+  words[2] = (nibble & 0x04) ? HD44780_MULTI_MASK : 0;
+  words[3] = (nibble & 0x08) ? HD44780_MULTI_MASK : 0;
+  // data lines
+  HD44780_MultiWrite(words);
+}
+
+/**
+ * @desc    Strobe shared E, nibble is latched by all displays
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void HD44780_MultiPulseE (void)
+{
+  // Set E
+  SETBIT(HD44780_MULTI_PORT_CTRL, HD44780_MULTI_E);
+  // PWeh, clear E is spent in pulse
+  HD44780_DELAY_NS(HD44780_T_PWEH, HD44780_CYC_SBI);
+  // Clear E
+  CLRBIT(HD44780_MULTI_PORT_CTRL, HD44780_MULTI_E);
+  // TcycE - PWeh, next E is preceded by port words set up
+  HD44780_DELAY_NS(HD44780_T_CYCE - HD44780_T_PWEH, HD44780_CYC_NIBBLE);
+}
+
+/**
+ * @desc    Set data lines of displays as outputs / inputs
+ *
+ * @param   char output {0; 1}
+ *
+ * @return  void
+ */
+static void HD44780_MultiDirection (char output)
+{
+  // outputs
+  if (output) {
+    HD44780_MULTI_DDR_DB4 |= HD44780_MULTI_MASK;
+    HD44780_MULTI_DDR_DB5 |= HD44780_MULTI_MASK;
+    HD44780_MULTI_DDR_DB6 |= HD44780_MULTI_MASK;
+    HD44780_MULTI_DDR_DB7 |= HD44780_MULTI_MASK;
+  // inputs with pull-up resistors
+  } else {
+    HD44780_MULTI_DDR_DB4 &= (unsigned char) ~HD44780_MULTI_MASK;
+    HD44780_MULTI_DDR_DB5 &= (unsigned char) ~HD44780_MULTI_MASK;
+    HD44780_MULTI_DDR_DB6 &= (unsigned char) ~HD44780_MULTI_MASK;
+    HD44780_MULTI_DDR_DB7 &= (unsigned char) ~HD44780_MULTI_MASK;
+    HD44780_MultiWriteNibble(0x0F);
+  }
+}
+
+/**
+ * @desc    Check Busy Flag (BF) of all displays, waits until
+ *          last display is ready
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void HD44780_MultiCheckBF (void)
+{
+  unsigned char busy;
+
+  // DB7-DB4 as input
+  HD44780_MultiDirection(0);
+  // clear RS
+  CLRBIT(HD44780_MULTI_PORT_CTRL, HD44780_MULTI_RS);
+  // set RW - read instruction
+  SETBIT(HD44780_MULTI_PORT_CTRL, HD44780_MULTI_RW);
+  // tAS - RW set up before E rises
+  HD44780_DELAY_NS(HD44780_T_AS, HD44780_CYC_SBI);
+
+  // busy flag of display p on bit p of DB7 port
+  do {
+    // Read upper nibble
+    // --------------------------------
+    // Set E
+    SETBIT(HD44780_MULTI_PORT_CTRL, HD44780_MULTI_E);
+    // tDDR, PIN is synchronized one cycle later
+    HD44780_DELAY_CYCLES(HD44780_CYCLES(HD44780_T_DDR) + HD44780_CYC_SYNC);
+    // busy flags
+    busy = HD44780_MULTI_PIN_DB7 & HD44780_MULTI_MASK;
+    // rest of PWeh
+    HD44780_DELAY_NS(HD44780_T_PWEH, HD44780_CYCLES(HD44780_T_DDR) + HD44780_CYC_SYNC + HD44780_CYC_IN + HD44780_CYC_SBI);
+    // Clear E
+    CLRBIT(HD44780_MULTI_PORT_CTRL, HD44780_MULTI_E);
+    // TcycE - PWeh, next E rises immediately
+    HD44780_DELAY_NS(HD44780_T_CYCE - HD44780_T_PWEH, HD44780_CYC_SBI);
+
+    // Lower nibble (AC) not used
+    // --------------------------------
+    // Set E
+    SETBIT(HD44780_MULTI_PORT_CTRL, HD44780_MULTI_E);
+    // PWeh
+    HD44780_DELAY_NS(HD44780_T_PWEH, HD44780_CYC_SBI);
+    // Clear E
+    CLRBIT(HD44780_MULTI_PORT_CTRL, HD44780_MULTI_E);
+    // TcycE - PWeh, next E rises immediately
+    HD44780_DELAY_NS(HD44780_T_CYCE - HD44780_T_PWEH, HD44780_CYC_SBI);
+  // until all displays are ready
+  } while (busy);
+
+  // clear RW
+  CLRBIT(HD44780_MULTI_PORT_CTRL, HD44780_MULTI_RW);
+  // DB7-DB4 as output
+  HD44780_MultiDirection(1);
+}
+
+/**
+ * @desc    Init all displays at once
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_MultiInit (void)
+{
+  // set E, RS, RW as output
+  SETBIT(HD44780_MULTI_DDR_CTRL, HD44780_MULTI_E);
+  SETBIT(HD44780_MULTI_DDR_CTRL, HD44780_MULTI_RS);
+  SETBIT(HD44780_MULTI_DDR_CTRL, HD44780_MULTI_RW);
+  // clear E, RS, RW
+  CLRBIT(HD44780_MULTI_PORT_CTRL, HD44780_MULTI_E);
+  CLRBIT(HD44780_MULTI_PORT_CTRL, HD44780_MULTI_RS);
+  CLRBIT(HD44780_MULTI_PORT_CTRL, HD44780_MULTI_RW);
+  // set DB7-DB4 as output
+  HD44780_MultiDirection(1);
+
+  // delay > 15ms
+  _delay_ms(16);
+
+  // Busy Flag (BF) cannot be checked in these instructions
+  // ---------------------------------------------------------------------
+  // Initial sequence 0x3
+  HD44780_MultiWriteNibble(HD44780_INIT_SEQ >> 4);
+  HD44780_MultiPulseE();
+  // delay > 4.1ms
+  _delay_ms(5);
+  // Initial sequence 0x3
+  HD44780_MultiPulseE();
+  // delay > 100us
+  _delay_us(110);
+  // Initial sequence 0x3
+  HD44780_MultiPulseE();
+  // delay > 45us (=37+4 * 270/250)
+  _delay_us(50);
+  // 4 bit mode 0x2
+  HD44780_MultiWriteNibble(HD44780_4BIT_MODE >> 4);
+  HD44780_MultiPulseE();
+  // delay > 45us (=37+4 * 270/250)
+  _delay_us(50);
+  // ----------------------------------------------------------------------
+
+  // 4-bit & 2-lines & 5x8-dots 0x28
+  HD44780_MultiSendInstruction(HD44780_4BIT_MODE | HD44780_2_ROWS | HD44780_FONT_5x8);
+  // display off 0x08
+  HD44780_MultiSendInstruction(HD44780_DISP_OFF);
+  // display clear 0x01
+  HD44780_MultiSendInstruction(HD44780_DISP_CLEAR);
+  // entry mode set 0x06
+  HD44780_MultiSendInstruction(HD44780_ENTRY_MODE);
+}
+
+/**
+ * @desc    Send instruction to all displays
+ *
+ * @param   unsigned char
+ *
+ * @return  void
+ */
+void HD44780_MultiSendInstruction (unsigned char data)
+{
+  // Clear RS
+  CLRBIT(HD44780_MULTI_PORT_CTRL, HD44780_MULTI_RS);
+  // upper and lower nibble
+  HD44780_MultiWriteNibble(data >> 4);
+  HD44780_MultiPulseE();
+  HD44780_MultiWriteNibble(data);
+  HD44780_MultiPulseE();
+  // check busy flags
+  HD44780_MultiCheckBF();
+}
+
+/**
+ * @desc    Send data byte per display, bytes are transposed
+ *          into port words
+ *
+ * @param   const unsigned char * HD44780_MULTI_PANELS bytes
+ *
+ * @return  void
+ */
+void HD44780_MultiSendData (const unsigned char *bytes)
+{
+  // port word per bit of byte, bit p = display p
+  unsigned char words[8] = { 0 };
+  unsigned char mask = 1;
+  unsigned char byte;
+  unsigned char p;
+  unsigned char i;
+
+  // transpose 8 x HD44780_MULTI_PANELS bit matrix
+  for (p = 0; p < HD44780_MULTI_PANELS; p++) {
+    byte = bytes[p];
+    for (i = 0; i < 8; i++) {
+      if (byte & 1) {
+        words[i] |= mask;
+      }
+      byte >>= 1;
+    }
+    mask <<= 1;
+  }
+  // Set RS
+  SETBIT(HD44780_MULTI_PORT_CTRL, HD44780_MULTI_RS);
+  // upper nibble - words of bits 7-4
+  HD44780_MultiWrite(&words[4]);
+  HD44780_MultiPulseE();
+  // lower nibble - words of bits 3-0
+  HD44780_MultiWrite(&words[0]);
+  HD44780_MultiPulseE();
+  // check busy flags
+  HD44780_MultiCheckBF();
+}
+
+/**
+ * @desc    Send same data byte to all displays, no transpose
+ *
+ * @param   unsigned char
+ *
+ * @return  void
+ */
+void HD44780_MultiBroadcast (unsigned char data)
+{
+  // Set RS
+  SETBIT(HD44780_MULTI_PORT_CTRL, HD44780_MULTI_RS);
+  // upper and lower nibble
+  HD44780_MultiWriteNibble(data >> 4);
+  HD44780_MultiPulseE();
+  HD44780_MultiWriteNibble(data);
+  HD44780_MultiPulseE();
+  // check busy flags
+  HD44780_MultiCheckBF();
+}
+
+/**
+ * @desc    Go to position x,y on all displays
+ *
+ * @param   char x
+ * @param   char y
+ *
+ * @return  char
+ */
+char HD44780_MultiPositionXY (char x, char y)
+{
+  // check position
+  if ((x >= HD44780_COLS) || (y >= HD44780_ROWS)) {
+    // error
+    return ERROR;
+  }
+  // row start
+  if (y == 0) {
+    HD44780_MultiSendInstruction(HD44780_POSITION | (HD44780_ROW1_START + x));
+  } else {
+    HD44780_MultiSendInstruction(HD44780_POSITION | (HD44780_ROW2_START + x));
+  }
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Draw string per display from current position,
+ *          shorter strings are padded with spaces
+ *
+ * @param   char ** HD44780_MULTI_PANELS strings
+ *
+ * @return  void
+ */
+void HD44780_MultiDrawStrings (char **str)
+{
+  unsigned char bytes[HD44780_MULTI_PANELS];
+  unsigned char pos[HD44780_MULTI_PANELS] = { 0 };
+  unsigned char same;
+  unsigned char left;
+  unsigned char p;
+
+  // column by column
+  while (1) {
+    same = 1;
+    left = 0;
+    // char of each display, space after end of string
+    for (p = 0; p < HD44780_MULTI_PANELS; p++) {
+      bytes[p] = ' ';
+      if (str[p][pos[p]] != '\0') {
+        bytes[p] = str[p][pos[p]++];
+        left = 1;
+      }
+      if (bytes[p] != bytes[0]) {
+        same = 0;
+      }
+    }
+    // all strings drawn
+    if (!left) {
+      break;
+    }
+    // equal column needs no transpose
+    if (same) {
+      HD44780_MultiBroadcast(bytes[0]);
+    } else {
+      HD44780_MultiSendData(bytes);
+    }
+  }
+}
+
+/**
+ * @desc    Draw same string on all displays from current
+ *          position
+ *
+ * @param   char *
+ *
+ * @return  void
+ */
+void HD44780_MultiDrawString (char *str)
+{
+  // loop through chars
+  while (*str != '\0') {
+    HD44780_MultiBroadcast(*str++);
+  }
+}
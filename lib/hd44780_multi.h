@@ -0,0 +1,172 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Bit-Sliced Drive of Several Displays
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_multi.h
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h
+ * ---------------------------------------------------------------+
+ * @usage       up to 8 identical displays in 4 bit mode, display p
+ *              has DB4-DB7 on bit p of 4 data ports, E, RS and RW
+ *              are shared
+ *
+ *              PORT_DB7   | p7 | p6 | ... | p1 | p0 |
+ *              PORT_DB6   | p7 | p6 | ... | p1 | p0 |
+ *              PORT_DB5   | p7 | p6 | ... | p1 | p0 |
+ *              PORT_DB4   | p7 | p6 | ... | p1 | p0 |
+ *
+ *              one write of 4 ports + one E strobe sends nibble to
+ *              all displays, bytes per display are transposed into
+ *              port words, broadcast of same byte skips transpose,
+ *              busy flags of all displays are read at once
+ */
+#ifndef __HD44780_MULTI_H__
+#define __HD44780_MULTI_H__
+
+  #include "hd44780.h"
+
+  // count of displays {1; 2; ... 8}, display p on bit p
+  #ifndef HD44780_MULTI_PANELS
+    #define HD44780_MULTI_PANELS  4
+  #endif
+  #if (HD44780_MULTI_PANELS < 1) || (HD44780_MULTI_PANELS > 8)
+    #error "HD44780_MULTI_PANELS must be 1 to 8"
+  #endif
+  // bits of displays in data ports
+  #define HD44780_MULTI_BITS      ((1 << HD44780_MULTI_PANELS) - 1)
+  #define HD44780_MULTI_MASK      ((unsigned char) HD44780_MULTI_BITS)
+
+  // data ports, one per data line
+  // --------------------------------------
+  #ifndef HD44780_MULTI_DDR_DB4
+    #define HD44780_MULTI_DDR_DB4   DDRA
+  #endif
+  #ifndef HD44780_MULTI_PORT_DB4
+    #define HD44780_MULTI_PORT_DB4  PORTA
+  #endif
+  #ifndef HD44780_MULTI_DDR_DB5
+    #define HD44780_MULTI_DDR_DB5   DDRB
+  #endif
+  #ifndef HD44780_MULTI_PORT_DB5
+    #define HD44780_MULTI_PORT_DB5  PORTB
+  #endif
+  #ifndef HD44780_MULTI_DDR_DB6
+    #define HD44780_MULTI_DDR_DB6   DDRC
+  #endif
+  #ifndef HD44780_MULTI_PORT_DB6
+    #define HD44780_MULTI_PORT_DB6  PORTC
+  #endif
+  #ifndef HD44780_MULTI_DDR_DB7
+    #define HD44780_MULTI_DDR_DB7   DDRD
+  #endif
+  #ifndef HD44780_MULTI_PORT_DB7
+    #define HD44780_MULTI_PORT_DB7  PORTD
+  #endif
+  // busy flags of displays
+  #ifndef HD44780_MULTI_PIN_DB7
+    #define HD44780_MULTI_PIN_DB7   PIND
+  #endif
+
+  // shared control pins, above bits of displays (default pins allow
+  // up to 4 displays, 5-8 need control on port without data)
+  // --------------------------------------
+  #ifndef HD44780_MULTI_DDR_CTRL
+    #define HD44780_MULTI_DDR_CTRL  DDRD
+  #endif
+  #ifndef HD44780_MULTI_PORT_CTRL
+    #define HD44780_MULTI_PORT_CTRL PORTD
+  #endif
+  #ifndef HD44780_MULTI_RS
+    #define HD44780_MULTI_RS      4
+  #endif
+  #ifndef HD44780_MULTI_RW
+    #define HD44780_MULTI_RW      5
+  #endif
+  #ifndef HD44780_MULTI_E
+    #define HD44780_MULTI_E       6
+  #endif
+  // control port is one of data ports {0; 1}, port names can not be
+  // compared by preprocessor, set 0 if control pins have own port
+  #ifndef HD44780_MULTI_CTRL_SHARED
+    #define HD44780_MULTI_CTRL_SHARED 1
+  #endif
+
+  // port writes of data would overwrite control pins
+  #if HD44780_MULTI_CTRL_SHARED && (HD44780_MULTI_BITS & ((1 << HD44780_MULTI_RS) | (1 << HD44780_MULTI_RW) | (1 << HD44780_MULTI_E)))
+    #error "HD44780_MULTI_RS, RW, E overlap bits of displays, lower HD44780_MULTI_PANELS or move control pins to own port (HD44780_MULTI_CTRL_SHARED 0)"
+  #endif
+
+  /**
+   * @desc    Init all displays at once
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_MultiInit (void);
+
+  /**
+   * @desc    Send instruction to all displays
+   *
+   * @param   unsigned char
+   *
+   * @return  void
+   */
+  void HD44780_MultiSendInstruction (unsigned char);
+
+  /**
+   * @desc    Send data byte per display, bytes are transposed
+   *          into port words
+   *
+   * @param   const unsigned char * HD44780_MULTI_PANELS bytes
+   *
+   * @return  void
+   */
+  void HD44780_MultiSendData (const unsigned char *);
+
+  /**
+   * @desc    Send same data byte to all displays, no transpose
+   *
+   * @param   unsigned char
+   *
+   * @return  void
+   */
+  void HD44780_MultiBroadcast (unsigned char);
+
+  /**
+   * @desc    Go to position x,y on all displays
+   *
+   * @param   char x
+   * @param   char y
+   *
+   * @return  char
+   */
+  char HD44780_MultiPositionXY (char, char);
+
+  /**
+   * @desc    Draw string per display from current position,
+   *          shorter strings are padded with spaces
+   *
+   * @param   char ** HD44780_MULTI_PANELS strings
+   *
+   * @return  void
+   */
+  void HD44780_MultiDrawStrings (char **);
+
+  /**
+   * @desc    Draw same string on all displays from current
+   *          position
+   *
+   * @param   char *
+   *
+   * @return  void
+   */
+  void HD44780_MultiDrawString (char *);
+
+#endif
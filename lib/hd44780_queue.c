@@ -0,0 +1,261 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 ISR-Safe Draw Queues
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_queue.c
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_shadow.h, hd44780_field.h, hd44780_queue.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#include "hd44780.h"
+#include "hd44780_shadow.h"
+#include "hd44780_field.h"
+#include "hd44780_queue.h"
+
+// index mask
+#define HD44780_QUEUE_MASK      (HD44780_QUEUE_SIZE - 1)
+
+/**
+ * @desc    Queue init, call before producer is enabled
+ *
+ * @param   HD44780_Queue *
+ *
+ * @return  void
+ */
+void HD44780_QueueInit (HD44780_Queue *queue)
+{
+  unsigned char i;
+
+  // empty
+  queue->head = 0;
+  queue->tail = 0;
+  queue->dropped = 0;
+  // no field seen
+  for (i = 0; i < HD44780_QUEUE_FIELDS; i++) {
+    queue->fields[i] = 0;
+  }
+}
+
+/**
+ * @desc    Remember field updated by queue, consumer side
+ *
+ * @param   HD44780_Queue *
+ * @param   HD44780_Field *
+ *
+ * @return  void
+ */
+static void HD44780_QueueRemember (HD44780_Queue *queue, HD44780_Field *field)
+{
+  unsigned char i;
+
+  // known or first free slot, full list keeps old fields
+  for (i = 0; i < HD44780_QUEUE_FIELDS; i++) {
+    if (queue->fields[i] == field) {
+      return;
+    }
+    if (queue->fields[i] == 0) {
+      queue->fields[i] = field;
+      return;
+    }
+  }
+}
+
+/**
+ * @desc    Reserve slot of head, producer side
+ *
+ * @param   HD44780_Queue *
+ *
+ * @return  HD44780_QueueMsg * 0 if queue is full
+ */
+static HD44780_QueueMsg *HD44780_QueueReserve (HD44780_Queue *queue)
+{
+  unsigned char head = queue->head;
+
+  // full, consumer frees slot by tail store
+  if (((head + 1) & HD44780_QUEUE_MASK) == queue->tail) {
+    queue->dropped++;
+    return 0;
+  }
+  // slot owned by producer until publish
+  return &queue->msgs[head];
+}
+
+/**
+ * @desc    Publish reserved slot, producer side
+ *
+ * @param   HD44780_Queue *
+ *
+ * @return  void
+ */
+static void HD44780_QueuePublish (HD44780_Queue *queue)
+{
+  // message stored before head
+  HD44780_QUEUE_BARRIER();
+  // single byte store, seen whole by consumer
+  queue->head = (queue->head + 1) & HD44780_QUEUE_MASK;
+}
+
+/**
+ * @desc    Enqueue cell write, producer side
+ *
+ * @param   HD44780_Queue *
+ * @param   unsigned char x
+ * @param   unsigned char y
+ * @param   char
+ *
+ * @return  char ERROR if queue is full or cell out of display
+ */
+char HD44780_QueueCell (HD44780_Queue *queue, unsigned char x, unsigned char y, char character)
+{
+  HD44780_QueueMsg *msg;
+
+  // check position
+  if ((x >= HD44780_COLS) || (y >= HD44780_ROWS)) {
+    // error
+    return ERROR;
+  }
+  // free slot
+  msg = HD44780_QueueReserve(queue);
+  if (msg == 0) {
+    // error
+    return ERROR;
+  }
+  // message
+  msg->type = HD44780_QUEUE_CELL;
+  msg->x = x;
+  msg->y = y;
+  msg->data = character;
+  // visible to consumer
+  HD44780_QueuePublish(queue);
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Enqueue field update, producer side
+ *
+ * @param   HD44780_Queue *
+ * @param   HD44780_Field *
+ * @param   long value
+ *
+ * @return  char ERROR if queue is full
+ */
+char HD44780_QueueField (HD44780_Queue *queue, HD44780_Field *field, long value)
+{
+  HD44780_QueueMsg *msg = HD44780_QueueReserve(queue);
+
+  // free slot
+  if (msg == 0) {
+    // error
+    return ERROR;
+  }
+  // message
+  msg->type = HD44780_QUEUE_FIELD;
+  msg->field = field;
+  msg->value = value;
+  // visible to consumer
+  HD44780_QueuePublish(queue);
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Enqueue instruction, producer side
+ *
+ * @param   HD44780_Queue *
+ * @param   unsigned char
+ *
+ * @return  char ERROR if queue is full
+ */
+char HD44780_QueueCommand (HD44780_Queue *queue, unsigned char instruction)
+{
+  HD44780_QueueMsg *msg = HD44780_QueueReserve(queue);
+
+  // free slot
+  if (msg == 0) {
+    // error
+    return ERROR;
+  }
+  // message
+  msg->type = HD44780_QUEUE_COMMAND;
+  msg->data = instruction;
+  // visible to consumer
+  HD44780_QueuePublish(queue);
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Drain messages queued before call, consumer side
+ *          (display task, never from interrupt)
+ *
+ * @param   HD44780_Queue *
+ *
+ * @return  unsigned char count of processed messages
+ */
+unsigned char HD44780_QueueRun (HD44780_Queue *queue)
+{
+  // messages published later wait for next run
+  unsigned char head = queue->head;
+  unsigned char tail = queue->tail;
+  unsigned char count = 0;
+  unsigned char cells = 0;
+  unsigned char i;
+  HD44780_QueueMsg msg;
+
+  // head read before messages
+  HD44780_QUEUE_BARRIER();
+  // loop through messages
+  while (tail != head) {
+    // copy out, slot is freed before slow LCD writes
+    msg = queue->msgs[tail];
+    tail = (tail + 1) & HD44780_QUEUE_MASK;
+    // message read before tail
+    HD44780_QUEUE_BARRIER();
+    queue->tail = tail;
+    count++;
+    // cell - plain store, coalesced by flush
+    if (msg.type == HD44780_QUEUE_CELL) {
+      HD44780_Frame[msg.y][msg.x] = msg.data;
+      cells = 1;
+      continue;
+    }
+    // earlier cells are sent before field or command
+    if (cells) {
+      HD44780_ShadowFlush();
+      cells = 0;
+    }
+    // field - changed digits only
+    if (msg.type == HD44780_QUEUE_FIELD) {
+      HD44780_QueueRemember(queue, msg.field);
+      HD44780_FieldUpdate(msg.field, msg.value);
+    // command
+    } else if (msg.type == HD44780_QUEUE_COMMAND) {
+      HD44780_SendInstruction(msg.data);
+      // cleared display, requested content cleared too
+      if (msg.data == HD44780_DISP_CLEAR) {
+        HD44780_ShadowClear();
+        HD44780_ShadowReset();
+        // rendered cells of fields are gone
+        for (i = 0; (i < HD44780_QUEUE_FIELDS) && queue->fields[i]; i++) {
+          HD44780_FieldInvalidate(queue->fields[i]);
+        }
+      }
+    }
+  }
+  // cells with one set address per run
+  if (cells) {
+    HD44780_ShadowFlush();
+  }
+  // count of messages
+  return count;
+}
@@ -0,0 +1,133 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 ISR-Safe Draw Queues
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_queue.h
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_shadow.h, hd44780_field.h
+ * ---------------------------------------------------------------+
+ * @usage       single producer single consumer queue per interrupt
+ *              source, interrupt handler enqueues fixed size
+ *              messages (cell, field, command), display task drains
+ *              queues by HD44780_QueueRun
+ *              - producer writes only head, consumer only tail,
+ *                both are bytes (atomic store), interrupts are never
+ *                disabled
+ *              - enqueue = check + copy of message + publish, no
+ *                loop, full queue drops message (counted)
+ *              - cells are written into HD44780_Frame and sent by
+ *                one HD44780_ShadowFlush after drain
+ *              - queued HD44780_DISP_CLEAR invalidates shadow and
+ *                fields seen by queue (up to HD44780_QUEUE_FIELDS),
+ *                other fields need HD44780_FieldInvalidate
+ */
+#ifndef __HD44780_QUEUE_H__
+#define __HD44780_QUEUE_H__
+
+  #include "hd44780.h"
+  #include "hd44780_field.h"
+
+  // messages per queue (power of 2), one slot stays free
+  #ifndef HD44780_QUEUE_SIZE
+    #define HD44780_QUEUE_SIZE    8
+  #endif
+
+  #if (HD44780_QUEUE_SIZE & (HD44780_QUEUE_SIZE - 1)) || (HD44780_QUEUE_SIZE > 128)
+    #error "HD44780_QUEUE_SIZE must be power of 2 up to 128"
+  #endif
+
+  // fields remembered per queue, invalidated by queued display clear
+  #ifndef HD44780_QUEUE_FIELDS
+    #define HD44780_QUEUE_FIELDS  4
+  #endif
+
+  // message stores before index store
+  #if defined(HD44780_LINUX)
+    #define HD44780_QUEUE_BARRIER() __sync_synchronize()
+  #else
+    #define HD44780_QUEUE_BARRIER() __asm__ __volatile__ ("" ::: "memory")
+  #endif
+
+  // types of messages
+  #define HD44780_QUEUE_CELL      0
+  #define HD44780_QUEUE_FIELD     1
+  #define HD44780_QUEUE_COMMAND   2
+
+  // message
+  typedef struct {
+    unsigned char type;             // HD44780_QUEUE_*
+    unsigned char x;                // cell column
+    unsigned char y;                // cell row
+    unsigned char data;             // cell char / instruction
+    HD44780_Field *field;           // field to update
+    long value;                     // field value
+  } HD44780_QueueMsg;
+
+  // queue, zero initialised is empty
+  typedef struct {
+    volatile unsigned char head;    // written by producer
+    volatile unsigned char tail;    // written by consumer
+    volatile unsigned char dropped; // messages lost on full queue
+    HD44780_QueueMsg msgs[HD44780_QUEUE_SIZE];
+    HD44780_Field *fields[HD44780_QUEUE_FIELDS]; // updated by consumer
+  } HD44780_Queue;
+
+  /**
+   * @desc    Queue init, call before producer is enabled
+   *
+   * @param   HD44780_Queue *
+   *
+   * @return  void
+   */
+  void HD44780_QueueInit (HD44780_Queue *);
+
+  /**
+   * @desc    Enqueue cell write, producer side
+   *
+   * @param   HD44780_Queue *
+   * @param   unsigned char x
+   * @param   unsigned char y
+   * @param   char
+   *
+   * @return  char ERROR if queue is full or cell out of display
+   */
+  char HD44780_QueueCell (HD44780_Queue *, unsigned char, unsigned char, char);
+
+  /**
+   * @desc    Enqueue field update, producer side
+   *
+   * @param   HD44780_Queue *
+   * @param   HD44780_Field *
+   * @param   long value
+   *
+   * @return  char ERROR if queue is full
+   */
+  char HD44780_QueueField (HD44780_Queue *, HD44780_Field *, long);
+
+  /**
+   * @desc    Enqueue instruction, producer side
+   *
+   * @param   HD44780_Queue *
+   * @param   unsigned char
+   *
+   * @return  char ERROR if queue is full
+   */
+  char HD44780_QueueCommand (HD44780_Queue *, unsigned char);
+
+  /**
+   * @desc    Drain messages queued before call, consumer side
+   *          (display task, never from interrupt)
+   *
+   * @param   HD44780_Queue *
+   *
+   * @return  unsigned char count of processed messages
+   */
+  unsigned char HD44780_QueueRun (HD44780_Queue *);
+
+#endif
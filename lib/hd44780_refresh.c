@@ -0,0 +1,259 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Background Refresh Engine
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_refresh.c
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_shadow.h, hd44780_refresh.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD, entry mode increment
+ */
+
+// include libraries
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "hd44780.h"
+#include "hd44780_shadow.h"
+#include "hd44780_refresh.h"
+#if HD44780_USE_TRACE
+#include "hd44780_trace.h"
+#endif
+
+// statistics
+volatile HD44780_RefreshStats HD44780_RefreshStat;
+
+// command queue, head written by application, tail by interrupt
+static volatile unsigned char HD44780_RefreshQueue[HD44780_REFRESH_QUEUE];
+static volatile unsigned char HD44780_RefreshHead = 0;
+static volatile unsigned char HD44780_RefreshTail = 0;
+
+// scan position
+static unsigned char HD44780_RefreshX = 0;
+static unsigned char HD44780_RefreshY = 0;
+
+/**
+ * @desc    Refresh start - LCD and shadow must be initialised
+ *          (HD44780_Init, HD44780_ShadowInit), interrupts enabled by sei()
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_RefreshStart (void)
+{
+  // compare value
+  OCR2 = HD44780_REFRESH_OCR;
+  // clear counter
+  TCNT2 = 0;
+  // CTC mode, prescaler 64
+  TCCR2 = (1 << WGM21) | (1 << CS22);
+  // enable compare interrupt
+  SETBIT(TIMSK, OCIE2);
+}
+
+/**
+ * @desc    Refresh stop
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_RefreshStop (void)
+{
+  // disable compare interrupt
+  CLRBIT(TIMSK, OCIE2);
+  // stop timer
+  TCCR2 = 0;
+}
+
+/**
+ * @desc    Queue instruction, sent before next dirty cell
+ *
+ * @param   unsigned char
+ *
+ * @return  char ERROR if queue is full
+ */
+char HD44780_RefreshCommand (unsigned char instruction)
+{
+  unsigned char next = (HD44780_RefreshHead + 1) & (HD44780_REFRESH_QUEUE - 1);
+
+  // queue full
+  if (next == HD44780_RefreshTail) {
+    return ERROR;
+  }
+  // store command
+  HD44780_RefreshQueue[HD44780_RefreshHead] = instruction;
+  // publish
+  HD44780_RefreshHead = next;
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Check if frame and command queue are sent
+ *
+ * @param   void
+ *
+ * @return  char 1 if LCD shows HD44780_Frame
+ */
+char HD44780_RefreshIdle (void)
+{
+  unsigned char x;
+  unsigned char y;
+
+  // pending command
+  if (HD44780_RefreshHead != HD44780_RefreshTail) {
+    return 0;
+  }
+  // dirty cell
+  for (y = 0; y < HD44780_ROWS; y++) {
+    for (x = 0; x < HD44780_COLS; x++) {
+      if (HD44780_Frame[y][x] != HD44780_Panel[y][x]) {
+        return 0;
+      }
+    }
+  }
+  // idle
+  return 1;
+}
+
+/**
+ * @desc    Refresh send instruction, address counter is tracked
+ *          by register cache
+ *
+ * @param   unsigned char
+ *
+ * @return  void
+ */
+static void HD44780_RefreshInstruction (unsigned char instruction)
+{
+  // clear RS
+  CLRBIT(HD44780_PORT_RS, HD44780_RS);
+  // send without waiting for BF, it is checked in next tick
+  HD44780_Send8bitsIn4bitMode(instruction);
+#if HD44780_USE_TRACE
+  // byte strobed out
+  HD44780_TraceStrobe();
+#endif
+  // cache registers and address counter
+  HD44780_CacheUpdate(instruction);
+  // display clear fills DDRAM with spaces, frame is repainted
+  if (instruction == HD44780_DISP_CLEAR) {
+    HD44780_ShadowReset();
+  }
+}
+
+/**
+ * @desc    Refresh tick - one instruction or one data byte,
+ *          called from timer interrupt
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_RefreshTick (void)
+{
+  unsigned char address;
+  unsigned char count;
+  char character;
+
+  // tick
+  HD44780_RefreshStat.ticks++;
+
+  // instruction in progress - try next tick
+  if (HD44780_ReadBFandAC() & BIT7) {
+    HD44780_RefreshStat.busy++;
+    return;
+  }
+
+  // pending command first
+  if (HD44780_RefreshHead != HD44780_RefreshTail) {
+    // send command
+    HD44780_RefreshInstruction(HD44780_RefreshQueue[HD44780_RefreshTail]);
+    // release slot
+    HD44780_RefreshTail = (HD44780_RefreshTail + 1) & (HD44780_REFRESH_QUEUE - 1);
+    HD44780_RefreshStat.bytes++;
+    return;
+  }
+
+  // find dirty cell, scan is bounded to one pass through display
+  for (count = 0; count < (HD44780_ROWS * HD44780_COLS); count++) {
+    // dirty cell found
+    if (HD44780_Frame[HD44780_RefreshY][HD44780_RefreshX] != HD44780_Panel[HD44780_RefreshY][HD44780_RefreshX]) {
+      break;
+    }
+    // next cell
+    if (++HD44780_RefreshX >= HD44780_COLS) {
+      HD44780_RefreshX = 0;
+      if (++HD44780_RefreshY >= HD44780_ROWS) {
+        HD44780_RefreshY = 0;
+      }
+    }
+  }
+  // frame is on display
+  if (count == (HD44780_ROWS * HD44780_COLS)) {
+    return;
+  }
+
+  // address counter elsewhere - set address, data goes in next tick
+  address = HD44780_ShadowAddress(HD44780_RefreshX, HD44780_RefreshY);
+  if (HD44780_GetAddress() != address) {
+    HD44780_RefreshInstruction(HD44780_POSITION | address);
+    HD44780_RefreshStat.bytes++;
+    return;
+  }
+
+  // read cell once, application may change it meanwhile
+  character = HD44780_Frame[HD44780_RefreshY][HD44780_RefreshX];
+  // set RS
+  SETBIT(HD44780_PORT_RS, HD44780_RS);
+  // send without waiting for BF, it is checked in next tick
+  HD44780_Send8bitsIn4bitMode(character);
+#if HD44780_USE_TRACE
+  // byte strobed out
+  HD44780_TraceStrobe();
+#endif
+  // clear RS
+  CLRBIT(HD44780_PORT_RS, HD44780_RS);
+  // panel is up to date
+  HD44780_Panel[HD44780_RefreshY][HD44780_RefreshX] = character;
+  // address moves by cached I/D, decrement mode costs set address per cell
+  HD44780_CacheData();
+  HD44780_RefreshStat.bytes++;
+}
+
+/**
+ * @desc    Timer 2 compare interrupt
+ *
+ * @param   TIMER2_COMP_vect
+ *
+ * @return  void
+ */
+ISR(TIMER2_COMP_vect)
+{
+  unsigned char start = TCNT2;
+  unsigned int cost;
+
+  // one step of refresh
+  HD44780_RefreshTick();
+
+  // cost of tick in timer counts
+  cost = TCNT2;
+  // counter cleared on compare match meanwhile, flag stays pending
+  // (cleared on vector entry), count read again after the flag
+  if (TIFR & (1 << OCF2)) {
+    cost = TCNT2 + (HD44780_REFRESH_OCR + 1);
+  }
+  cost -= start;
+  HD44780_RefreshStat.last = cost;
+  // worst case
+  if (cost > HD44780_RefreshStat.max) {
+    HD44780_RefreshStat.max = cost;
+  }
+}
@@ -0,0 +1,121 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Background Refresh Engine
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_refresh.h
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_shadow.h
+ * ---------------------------------------------------------------+
+ * @usage       Timer2 compare interrupt mirrors HD44780_Frame to LCD,
+ *              every tick sends at most one instruction or one data
+ *              byte, application writes are plain stores, e.g.
+ *              HD44780_Frame[1][4] = 'A';
+ *              While engine runs, LCD must not be driven directly,
+ *              instructions go through HD44780_RefreshCommand.
+ */
+#ifndef __HD44780_REFRESH_H__
+#define __HD44780_REFRESH_H__
+
+  #include "hd44780.h"
+  #include "hd44780_shadow.h"
+
+  #if !HD44780_USE_BF || (HD44780_MODE != HD44780_4BIT_MODE)
+    #error "hd44780_refresh requires HD44780_USE_BF in 4 bit mode"
+  #endif
+
+  // tick frequency [Hz]
+  #ifndef HD44780_REFRESH_HZ
+    #define HD44780_REFRESH_HZ      2000
+  #endif
+  // command queue size (power of 2)
+  #ifndef HD44780_REFRESH_QUEUE
+    #define HD44780_REFRESH_QUEUE   4
+  #endif
+
+  // timer 2 prescaler
+  #define HD44780_REFRESH_PRESCALER 64
+  // compare value
+  #define HD44780_REFRESH_OCR       ((_FCPU / HD44780_REFRESH_PRESCALER / HD44780_REFRESH_HZ) - 1)
+
+  #if HD44780_REFRESH_OCR > 255
+    #error "HD44780_REFRESH_HZ too low for timer 2"
+  #endif
+  // instruction or data write (37us + tADD 4us) must end within one tick
+  #if HD44780_REFRESH_HZ > 20000
+    #error "HD44780_REFRESH_HZ too high, tick must be longer than 50us"
+  #endif
+
+  // ticks blocked by slowest command, clear display / return home 1.52ms
+  #define HD44780_REFRESH_CMD_TICKS     (((1640UL * HD44780_REFRESH_HZ) + 999999UL) / 1000000UL + 1)
+  // refresh latency guarantee - ticks from frame store to LCD,
+  // full command queue plus set address and data for every cell
+  #define HD44780_REFRESH_LATENCY_TICKS ((HD44780_REFRESH_QUEUE * HD44780_REFRESH_CMD_TICKS) + (2 * HD44780_ROWS * HD44780_COLS))
+  // refresh latency guarantee [us]
+  #define HD44780_REFRESH_LATENCY_US    ((HD44780_REFRESH_LATENCY_TICKS * 1000000UL) / HD44780_REFRESH_HZ)
+
+  // tick instrumentation, cost in timer counts (1 count = prescaler cycles)
+  typedef struct {
+    unsigned int last;          // cost of last tick
+    unsigned int max;           // worst cost of tick
+    unsigned long ticks;        // count of ticks
+    unsigned long busy;         // ticks skipped because BF was set
+    unsigned long bytes;        // instructions and data sent
+  } HD44780_RefreshStats;
+
+  // statistics
+  extern volatile HD44780_RefreshStats HD44780_RefreshStat;
+
+  /**
+   * @desc    Refresh start - LCD and shadow must be initialised
+   *          (HD44780_Init, HD44780_ShadowInit), interrupts enabled by sei()
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_RefreshStart (void);
+
+  /**
+   * @desc    Refresh stop
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_RefreshStop (void);
+
+  /**
+   * @desc    Queue instruction, sent before next dirty cell
+   *
+   * @param   unsigned char
+   *
+   * @return  char ERROR if queue is full
+   */
+  char HD44780_RefreshCommand (unsigned char);
+
+  /**
+   * @desc    Refresh tick - one instruction or one data byte,
+   *          called from timer interrupt
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_RefreshTick (void);
+
+  /**
+   * @desc    Check if frame and command queue are sent
+   *
+   * @param   void
+   *
+   * @return  char 1 if LCD shows HD44780_Frame
+   */
+  char HD44780_RefreshIdle (void);
+
+#endif
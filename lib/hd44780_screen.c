@@ -0,0 +1,97 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Precompiled Screen Player
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_screen.c
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_screen.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#include <avr/pgmspace.h>
+#include <avr/eeprom.h>
+#include "hd44780.h"
+#include "hd44780_screen.h"
+
+// byte of stream from flash or EEPROM
+#define HD44780_SCREEN_READ(p, eeprom) ((eeprom) ? eeprom_read_byte(p) : pgm_read_byte(p))
+
+/**
+ * @desc    Play screen stream
+ *
+ * @param   const unsigned char * stream
+ * @param   unsigned char {0 - flash; 1 - EEPROM}
+ *
+ * @return  unsigned short int count of sent bytes
+ */
+static unsigned short int HD44780_PlayStream (const unsigned char *stream, unsigned char eeprom)
+{
+  unsigned short int sent = 0;
+  unsigned char record;
+
+  // data runs are compiled left to right, nothing sent if mode is cached
+  HD44780_SetEntryMode(1, 0);
+  // loop through records
+  while (1) {
+    record = HD44780_SCREEN_READ(stream++, eeprom);
+    // instruction or end
+    if (record == HD44780_SCREEN_ESC) {
+      record = HD44780_SCREEN_READ(stream++, eeprom);
+      if (record == HD44780_SCREEN_END) {
+        break;
+      }
+      HD44780_SendInstruction(record);
+      sent++;
+    // set CGRAM / DDRAM address
+    } else if (record > HD44780_SCREEN_DATA) {
+#if HD44780_USE_CGRAM
+      // glyphs are uploaded past shadow
+      if (record < HD44780_POSITION) {
+        HD44780_CGRAMValid = 0;
+      }
+#endif
+      HD44780_SendInstruction(record);
+      sent++;
+    // data run, address auto increments
+    } else {
+      sent += record;
+      while (record--) {
+        HD44780_SendData(HD44780_SCREEN_READ(stream++, eeprom));
+      }
+    }
+  }
+  // count of instructions and data bytes
+  return sent;
+}
+
+/**
+ * @desc    Play screen stream from flash
+ *
+ * @param   const unsigned char * stream in flash
+ *
+ * @return  unsigned short int count of sent bytes
+ */
+unsigned short int HD44780_Play (const unsigned char *stream)
+{
+  return HD44780_PlayStream(stream, 0);
+}
+
+/**
+ * @desc    Play screen stream from EEPROM
+ *
+ * @param   const unsigned char * stream in EEPROM
+ *
+ * @return  unsigned short int count of sent bytes
+ */
+unsigned short int HD44780_PlayEeprom (const unsigned char *stream)
+{
+  return HD44780_PlayStream(stream, 1);
+}
@@ -0,0 +1,53 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Precompiled Screen Player
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_screen.h
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h
+ * ---------------------------------------------------------------+
+ * @usage       screens are compiled on host by tools/hd44780_screen
+ *              from description (screens/<name>.scr) into byte streams
+ *              in flash (PROGMEM) or EEPROM (EEMEM), stream records:
+ *              - 0x00 i      instruction i, 0x00 0x00 end of stream
+ *              - 0x01 - 0x3F count of data bytes that follow
+ *              - 0x40 - 0x7F set CGRAM address (instruction itself)
+ *              - 0x80 - 0xFF set DDRAM address (instruction itself)
+ *              player sends records as they are, shadow frame is
+ *              not updated, CGRAM shadow is invalidated on upload
+ */
+#ifndef __HD44780_SCREEN_H__
+#define __HD44780_SCREEN_H__
+
+  #include "hd44780.h"
+
+  // records of stream
+  #define HD44780_SCREEN_ESC      0x00  // instruction follows, 0 - end
+  #define HD44780_SCREEN_END      0x00  // instruction of end
+  #define HD44780_SCREEN_DATA     0x3F  // longest data run
+
+  /**
+   * @desc    Play screen stream from flash
+   *
+   * @param   const unsigned char * stream in flash
+   *
+   * @return  unsigned short int count of sent bytes
+   */
+  unsigned short int HD44780_Play (const unsigned char *);
+
+  /**
+   * @desc    Play screen stream from EEPROM
+   *
+   * @param   const unsigned char * stream in EEPROM
+   *
+   * @return  unsigned short int count of sent bytes
+   */
+  unsigned short int HD44780_PlayEeprom (const unsigned char *);
+
+#endif
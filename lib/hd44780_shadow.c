@@ -0,0 +1,242 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Shadow Frame Buffer
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_shadow.c
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_shadow.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#include "hd44780.h"
+#include "hd44780_shadow.h"
+
+// requested content of display
+char HD44780_Frame[HD44780_ROWS][HD44780_COLS];
+// content of display DDRAM
+char HD44780_Panel[HD44780_ROWS][HD44780_COLS];
+
+// drawn cells of registered widgets
+static char *HD44780_ShadowDrawn[HD44780_SHADOW_WIDGETS];
+// count of cells of registered widgets
+static unsigned char HD44780_ShadowWidth[HD44780_SHADOW_WIDGETS];
+
+// start addresses of rows
+static const unsigned char HD44780_RowStart[4] = {
+  HD44780_ROW1_START,
+  HD44780_ROW2_START,
+  HD44780_ROW3_START,
+  HD44780_ROW4_START
+};
+
+/**
+ * @desc    Shadow init - both buffers cleared to spaces,
+ *          call after HD44780_Init / HD44780_DisplayClear
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_ShadowInit (void)
+{
+  unsigned char x;
+  unsigned char y;
+
+  // loop through rows
+  for (y = 0; y < HD44780_ROWS; y++) {
+    // loop through cols
+    for (x = 0; x < HD44780_COLS; x++) {
+      // clear DDRAM fills display with spaces
+      HD44780_Frame[y][x] = ' ';
+      HD44780_Panel[y][x] = ' ';
+    }
+  }
+}
+
+/**
+ * @desc    Shadow clear - clear requested content
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_ShadowClear (void)
+{
+  unsigned char x;
+  unsigned char y;
+
+  // loop through rows
+  for (y = 0; y < HD44780_ROWS; y++) {
+    // loop through cols
+    for (x = 0; x < HD44780_COLS; x++) {
+      // clear requested content
+      HD44780_Frame[y][x] = ' ';
+    }
+  }
+}
+
+/**
+ * @desc    Shadow reset - display was cleared, whole frame
+ *          is sent by next flush (except spaces), drawn cells
+ *          of registered widgets are reset to spaces
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_ShadowReset (void)
+{
+  unsigned char x;
+  unsigned char y;
+
+  // loop through rows
+  for (y = 0; y < HD44780_ROWS; y++) {
+    // loop through cols
+    for (x = 0; x < HD44780_COLS; x++) {
+      // clear DDRAM fills display with spaces
+      HD44780_Panel[y][x] = ' ';
+    }
+  }
+  // loop through widgets
+  for (y = 0; (y < HD44780_SHADOW_WIDGETS) && HD44780_ShadowDrawn[y]; y++) {
+    // widget cells are spaces too, next update redraws them
+    for (x = 0; x < HD44780_ShadowWidth[y]; x++) {
+      HD44780_ShadowDrawn[y][x] = ' ';
+    }
+  }
+}
+
+/**
+ * @desc    Shadow register drawn cells of widget, reset by
+ *          HD44780_ShadowReset (widget must outlive registration)
+ *
+ * @param   char * drawn cells
+ * @param   unsigned char count of cells
+ *
+ * @return  char ERROR if HD44780_SHADOW_WIDGETS are registered
+ */
+char HD44780_ShadowRegister (char *drawn, unsigned char width)
+{
+  unsigned char i;
+
+  // known or first free entry
+  for (i = 0; i < HD44780_SHADOW_WIDGETS; i++) {
+    if ((HD44780_ShadowDrawn[i] == drawn) || (HD44780_ShadowDrawn[i] == 0)) {
+      HD44780_ShadowDrawn[i] = drawn;
+      HD44780_ShadowWidth[i] = width;
+      // success
+      return SUCCESS;
+    }
+  }
+  // error
+  return ERROR;
+}
+
+/**
+ * @desc    DDRAM address of cell x, y
+ *
+ * @param   unsigned char x
+ * @param   unsigned char y
+ *
+ * @return  unsigned char
+ */
+unsigned char HD44780_ShadowAddress (unsigned char x, unsigned char y)
+{
+  // start of row + column
+  return HD44780_RowStart[y] + x;
+}
+
+/**
+ * @desc    Send changed cells of row, runs are extended over clean
+ *          gaps up to HD44780_SHADOW_GAP, one set address per run
+ *          unless address counter already points at run
+ *
+ * @param   unsigned char x
+ * @param   unsigned char y
+ * @param   const char * new cells
+ * @param   char * drawn cells, updated
+ * @param   unsigned char count of cells
+ *
+ * @return  unsigned char count of sent bytes
+ */
+unsigned char HD44780_ShadowSend (unsigned char x, unsigned char y, const char *cells, char *drawn, unsigned char width)
+{
+  unsigned char sent = 0;
+  unsigned char address;
+  unsigned char last;
+  unsigned char i = 0;
+  unsigned char j;
+
+#if HD44780_USE_SLEEP
+  // unpowered panel, drawn cells stay as they are
+  if (HD44780_PowerDown) {
+    return 0;
+  }
+#endif
+  // runs are sent left to right, nothing sent if mode is cached
+  HD44780_SetEntryMode(1, 0);
+  // loop through cells
+  while (i < width) {
+    // skip clean cell
+    if (cells[i] == drawn[i]) {
+      i++;
+      continue;
+    }
+    // find end of run, clean gaps up to HD44780_SHADOW_GAP
+    // are cheaper to resend than to set address again
+    last = i;
+    for (j = i + 1; j < width; j++) {
+      // dirty cell extends run
+      if (cells[j] != drawn[j]) {
+        last = j;
+      // gap too long
+      } else if ((j - last) > HD44780_SHADOW_GAP) {
+        break;
+      }
+    }
+    // cached address counter, set address only if elsewhere
+    address = HD44780_ShadowAddress(x + i, y);
+    if (HD44780_GetAddress() != address) {
+      HD44780_SendInstruction(HD44780_POSITION | address);
+      sent++;
+    }
+    // send run, address auto increments
+    while (i <= last) {
+      HD44780_SendData(cells[i]);
+      drawn[i] = cells[i];
+      sent++;
+      i++;
+    }
+  }
+  // count of instructions and data bytes
+  return sent;
+}
+
+/**
+ * @desc    Shadow flush - send changed cells row by row,
+ *          one set address instruction per contiguous run
+ *
+ * @param   void
+ *
+ * @return  unsigned char count of sent bytes
+ */
+unsigned char HD44780_ShadowFlush (void)
+{
+  unsigned char sent = 0;
+  unsigned char y;
+
+  // loop through rows
+  for (y = 0; y < HD44780_ROWS; y++) {
+    sent += HD44780_ShadowSend(0, y, HD44780_Frame[y], HD44780_Panel[y], HD44780_COLS);
+  }
+  // count of instructions and data bytes
+  return sent;
+}
@@ -0,0 +1,118 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Shadow Frame Buffer
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_shadow.h
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h
+ * ---------------------------------------------------------------+
+ * @usage       HD44780_Frame holds the requested content of DDRAM,
+ *              HD44780_Panel holds what was really sent to LCD.
+ *              Writes into HD44780_Frame are plain memory stores,
+ *              HD44780_ShadowFlush sends only differing cells.
+ */
+#ifndef __HD44780_SHADOW_H__
+#define __HD44780_SHADOW_H__
+
+  #include "hd44780.h"
+
+  // max count of clean cells sent inside one run instead of
+  // a new set address instruction (1 data byte = 1 instruction),
+  // shared by shadow, fields and graphs
+  #ifndef HD44780_SHADOW_GAP
+    #define HD44780_SHADOW_GAP    1
+  #endif
+
+  // widgets (fields, graphs) whose drawn cells are reset with panel
+  #ifndef HD44780_SHADOW_WIDGETS
+    #define HD44780_SHADOW_WIDGETS  8
+  #endif
+
+  // requested content of display
+  extern char HD44780_Frame[HD44780_ROWS][HD44780_COLS];
+  // content of display DDRAM
+  extern char HD44780_Panel[HD44780_ROWS][HD44780_COLS];
+
+  /**
+   * @desc    Shadow init - both buffers cleared to spaces,
+   *          call after HD44780_Init / HD44780_DisplayClear
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_ShadowInit (void);
+
+  /**
+   * @desc    Shadow clear - clear requested content
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_ShadowClear (void);
+
+  /**
+   * @desc    Shadow reset - display was cleared, whole frame
+   *          is sent by next flush (except spaces), drawn cells
+   *          of registered widgets are reset to spaces
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_ShadowReset (void);
+
+  /**
+   * @desc    Shadow register drawn cells of widget, reset by
+   *          HD44780_ShadowReset (widget must outlive registration)
+   *
+   * @param   char * drawn cells
+   * @param   unsigned char count of cells
+   *
+   * @return  char ERROR if HD44780_SHADOW_WIDGETS are registered
+   */
+  char HD44780_ShadowRegister (char *, unsigned char);
+
+  /**
+   * @desc    DDRAM address of cell x, y
+   *
+   * @param   unsigned char x
+   * @param   unsigned char y
+   *
+   * @return  unsigned char
+   */
+  unsigned char HD44780_ShadowAddress (unsigned char x, unsigned char y);
+
+  /**
+   * @desc    Send changed cells of row, runs are extended over clean
+   *          gaps up to HD44780_SHADOW_GAP, one set address per run
+   *          unless address counter already points at run
+   *
+   * @param   unsigned char x
+   * @param   unsigned char y
+   * @param   const char * new cells
+   * @param   char * drawn cells, updated
+   * @param   unsigned char count of cells
+   *
+   * @return  unsigned char count of sent bytes
+   */
+  unsigned char HD44780_ShadowSend (unsigned char, unsigned char, const char *, char *, unsigned char);
+
+  /**
+   * @desc    Shadow flush - send changed cells row by row,
+   *          one set address instruction per contiguous run
+   *
+   * @param   void
+   *
+   * @return  unsigned char count of sent bytes
+   */
+  unsigned char HD44780_ShadowFlush (void);
+
+#endif
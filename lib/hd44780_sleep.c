@@ -0,0 +1,194 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Sleep Levels
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_sleep.c
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_shadow.h, hd44780_sleep.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#include <util/delay.h>
+#include <avr/io.h>
+#include "hd44780.h"
+#include "hd44780_shadow.h"
+#include "hd44780_sleep.h"
+
+// sleep level
+static unsigned char HD44780_Level = HD44780_AWAKE;
+// display control before sleep
+static unsigned char HD44780_SavedDispCtrl;
+// entry mode before sleep
+static unsigned char HD44780_SavedEntryMode;
+
+/**
+ * @desc    Power on panel supply, call before first HD44780_Init
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_PowerOn (void)
+{
+  // switch on
+  if (HD44780_PWR_ON) {
+    SETBIT(HD44780_PORT_PWR, HD44780_PWR);
+  } else {
+    CLRBIT(HD44780_PORT_PWR, HD44780_PWR);
+  }
+  // power pin as output
+  SETBIT(HD44780_DDR_PWR, HD44780_PWR);
+  // supply rise time
+  _delay_ms(HD44780_PWR_DELAY);
+}
+
+/**
+ * @desc    Power off panel supply, pins are driven low so panel
+ *          is not supplied through them
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void HD44780_PowerOff (void)
+{
+  // control and data pins low (outputs since last instruction)
+  CLRBIT(HD44780_PORT_E, HD44780_E);
+  CLRBIT(HD44780_PORT_RS, HD44780_RS);
+  CLRBIT(HD44780_PORT_RW, HD44780_RW);
+  HD44780_SetUppNibble(0);
+  // switch off
+  if (HD44780_PWR_ON) {
+    CLRBIT(HD44780_PORT_PWR, HD44780_PWR);
+  } else {
+    SETBIT(HD44780_PORT_PWR, HD44780_PWR);
+  }
+  // power pin as output
+  SETBIT(HD44780_DDR_PWR, HD44780_PWR);
+}
+
+#if HD44780_USE_CGRAM
+/**
+ * @desc    Restore CGRAM slots with known content from shadow,
+ *          one upload per run of slots
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void HD44780_RestoreCGRAM (void)
+{
+  unsigned char first;
+  unsigned char slot = 0;
+
+  // loop through slots
+  while (slot < 8) {
+    // unknown content
+    if (!(HD44780_CGRAMValid & (1 << slot))) {
+      slot++;
+      continue;
+    }
+    // run of known slots
+    first = slot;
+    while ((slot < 8) && (HD44780_CGRAMValid & (1 << slot))) {
+      slot++;
+    }
+    // one set CGRAM address per run
+    HD44780_CGRAMWrite(first << 3, &HD44780_CGRAMShadow[first << 3], (slot - first) << 3);
+  }
+}
+#endif
+
+/**
+ * @desc    Sleep, registers are saved when going from awake
+ *
+ * @param   unsigned char level {HD44780_SLEEP_OFF; HD44780_SLEEP_POWER}
+ *
+ * @return  char
+ */
+char HD44780_Sleep (unsigned char level)
+{
+  // check level
+  if ((level != HD44780_SLEEP_OFF) && (level != HD44780_SLEEP_POWER)) {
+    // error
+    return ERROR;
+  }
+  // registers to restore, cache is valid while awake
+  if (HD44780_Level == HD44780_AWAKE) {
+    HD44780_SavedDispCtrl = HD44780_GetDisplayControl();
+    HD44780_SavedEntryMode = HD44780_GetEntryMode();
+  }
+  // display off, cursor and blink bits kept for wake
+  if (level == HD44780_SLEEP_OFF) {
+    HD44780_SetDisplay(0);
+  // supply off, DDRAM and CGRAM are lost, driver drops bus accesses
+  } else if (HD44780_Level != HD44780_SLEEP_POWER) {
+    HD44780_PowerOff();
+    HD44780_PowerDown = 1;
+  }
+  // power down can not go back to display off
+  if (HD44780_Level != HD44780_SLEEP_POWER) {
+    HD44780_Level = level;
+  }
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Wake, display content and registers are restored
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_Wake (void)
+{
+  // display off - DDRAM retained, one instruction
+  if (HD44780_Level == HD44780_SLEEP_OFF) {
+    HD44780_SetDisplay((HD44780_SavedDispCtrl & HD44780_DISP_D) ? 1 : 0);
+  // power down
+  } else if (HD44780_Level == HD44780_SLEEP_POWER) {
+    // supply, init leaves display off and cleared
+    HD44780_PowerOn();
+    HD44780_PowerDown = 0;
+    HD44780_Init();
+#if HD44780_USE_CGRAM
+    // glyphs before text using them
+    HD44780_RestoreCGRAM();
+#endif
+    // cleared DDRAM holds spaces, only other cells are sent,
+    // fields and graphs are redrawn by their next update
+    HD44780_ShadowReset();
+    HD44780_ShadowFlush();
+    // entry mode, flush leaves increment
+    if ((HD44780_SavedEntryMode != 0xFF) && (HD44780_SavedEntryMode != HD44780_GetEntryMode())) {
+      HD44780_SendInstruction(HD44780_SavedEntryMode);
+    }
+    // display shows restored content at once, one instruction
+    if ((HD44780_SavedDispCtrl != 0xFF) && (HD44780_SavedDispCtrl != HD44780_GetDisplayControl())) {
+      HD44780_SendInstruction(HD44780_SavedDispCtrl);
+    }
+  }
+  // awake
+  HD44780_Level = HD44780_AWAKE;
+}
+
+/**
+ * @desc    Sleep level
+ *
+ * @param   void
+ *
+ * @return  unsigned char {HD44780_AWAKE; HD44780_SLEEP_OFF; HD44780_SLEEP_POWER}
+ */
+unsigned char HD44780_SleepLevel (void)
+{
+  return HD44780_Level;
+}
@@ -0,0 +1,102 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Sleep Levels
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_sleep.h
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h
+ * ---------------------------------------------------------------+
+ * @usage       sleep levels:
+ *              - HD44780_SLEEP_OFF   display off, DDRAM retained,
+ *                                    wake = 1 instruction
+ *              - HD44780_SLEEP_POWER panel supply switched off by pin,
+ *                                    wake = init + registers + CGRAM
+ *                                    from shadow (HD44780_USE_CGRAM)
+ *                                    + non-space cells of shadow
+ *                                    frame, display turned on
+ *                                    after content is restored,
+ *                                    while powered down driver calls
+ *                                    return without bus access,
+ *                                    HD44780_Frame and CGRAM shadow
+ *                                    are restored on wake, fields and
+ *                                    graphs are redrawn by their next
+ *                                    update, direct draws are lost
+ *              background refresh has to be stopped before sleep
+ */
+#ifndef __HD44780_SLEEP_H__
+#define __HD44780_SLEEP_H__
+
+  #include "hd44780.h"
+
+  #if !HD44780_USE_SLEEP
+    #error "hd44780_sleep requires HD44780_USE_SLEEP"
+  #endif
+
+  // sleep levels
+  #define HD44780_AWAKE           0
+  #define HD44780_SLEEP_OFF       1
+  #define HD44780_SLEEP_POWER     2
+
+  // power pin - supply switch of panel
+  // --------------------------------------
+  #ifndef HD44780_DDR_PWR
+    #define HD44780_DDR_PWR       DDRD
+  #endif
+  #ifndef HD44780_PORT_PWR
+    #define HD44780_PORT_PWR      PORTD
+  #endif
+  #ifndef HD44780_PWR
+    #define HD44780_PWR           0
+  #endif
+  // level of pin when panel is powered {0; 1}
+  #ifndef HD44780_PWR_ON
+    #define HD44780_PWR_ON        1
+  #endif
+  // supply rise time [ms], init waits further 16 ms (40 ms at VCC 2.7 V)
+  #ifndef HD44780_PWR_DELAY
+    #define HD44780_PWR_DELAY     25
+  #endif
+
+  /**
+   * @desc    Power on panel supply, call before first HD44780_Init
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_PowerOn (void);
+
+  /**
+   * @desc    Sleep, registers are saved when going from awake
+   *
+   * @param   unsigned char level {HD44780_SLEEP_OFF; HD44780_SLEEP_POWER}
+   *
+   * @return  char
+   */
+  char HD44780_Sleep (unsigned char);
+
+  /**
+   * @desc    Wake, display content and registers are restored
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_Wake (void);
+
+  /**
+   * @desc    Sleep level
+   *
+   * @param   void
+   *
+   * @return  unsigned char {HD44780_AWAKE; HD44780_SLEEP_OFF; HD44780_SLEEP_POWER}
+   */
+  unsigned char HD44780_SleepLevel (void);
+
+#endif
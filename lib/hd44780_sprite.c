@@ -0,0 +1,244 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 CGRAM Sprites and Smooth Scroll
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_sprite.c
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_sprite.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#include <avr/pgmspace.h>
+#include "hd44780.h"
+#include "hd44780_sprite.h"
+
+/**
+ * @desc    Sprite init
+ *
+ * @param   HD44780_Sprite *
+ * @param   const unsigned char * bitmap, 8 rows
+ * @param   unsigned char first of 2 CGRAM slots {0; 1; ... 6}
+ * @param   unsigned char row
+ * @param   char background
+ *
+ * @return  char
+ */
+char HD44780_SpriteInit (HD44780_Sprite *sprite, const unsigned char *bitmap, unsigned char slot, unsigned char y, char background)
+{
+  // check slots and row
+  if ((slot > 6) || (y >= HD44780_ROWS)) {
+    // error
+    return ERROR;
+  }
+  // sprite
+  sprite->bitmap = bitmap;
+  sprite->slot = slot;
+  sprite->y = y;
+  sprite->background = background;
+  // not drawn yet
+  sprite->cell = HD44780_SPRITE_HIDDEN;
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Sprite move to pixel position
+ *
+ * @param   HD44780_Sprite *
+ * @param   unsigned char pixel x {0; 1; ... HD44780_COLS * 5 - 1}
+ *
+ * @return  unsigned char count of sent bytes
+ */
+unsigned char HD44780_SpriteMove (HD44780_Sprite *sprite, unsigned char px)
+{
+  unsigned char glyphs[16];
+  unsigned char offset;
+  unsigned char cell;
+  unsigned char sent = 0;
+  unsigned int row;
+  unsigned char i;
+
+  // cell and pixel offset inside cell
+  cell = px / HD44780_CHAR_WIDTH;
+  offset = px % HD44780_CHAR_WIDTH;
+  // out of display
+  if (cell >= HD44780_COLS) {
+    return 0;
+  }
+  // composite sprite into 2 glyphs (10 pixels, bit 9 is left)
+  for (i = 0; i < 8; i++) {
+    row = (unsigned int) sprite->bitmap[i] << (HD44780_CHAR_WIDTH - offset);
+    glyphs[i] = (row >> HD44780_CHAR_WIDTH) & 0x1F;
+    glyphs[i + 8] = row & 0x1F;
+  }
+  // sprite crosses cell boundary, cells are moved first
+  if (cell != sprite->cell) {
+    // restore background of left cell if not covered by new cells
+    if ((sprite->cell != HD44780_SPRITE_HIDDEN) && (sprite->cell != (cell + 1))) {
+      HD44780_PositionXY(sprite->cell, sprite->y);
+      HD44780_DrawChar(sprite->background);
+      sent += 2;
+      // right cell if not covered by new cells
+      if (((sprite->cell + 1) < HD44780_COLS) && ((sprite->cell + 1) != cell)) {
+        HD44780_DrawChar(sprite->background);
+        sent++;
+      }
+    // moved one cell left - right cell uncovered
+    } else if ((sprite->cell == (cell + 1)) && ((sprite->cell + 1) < HD44780_COLS)) {
+      HD44780_PositionXY(sprite->cell + 1, sprite->y);
+      HD44780_DrawChar(sprite->background);
+      sent += 2;
+    }
+    // draw glyphs
+    HD44780_PositionXY(cell, sprite->y);
+    HD44780_DrawChar(sprite->slot);
+    sent += 2;
+    // right glyph clipped at right edge
+    if ((cell + 1) < HD44780_COLS) {
+      HD44780_DrawChar(sprite->slot + 1);
+      sent++;
+    }
+    // remember cell
+    sprite->cell = cell;
+  }
+  // both glyphs as one range, changed rows only, cells follow at once
+  sent += HD44780_CGRAMUpdateSlots(sprite->slot, glyphs, 2);
+  // count of sent bytes
+  return sent;
+}
+
+/**
+ * @desc    Sprite hide, background is restored
+ *
+ * @param   HD44780_Sprite *
+ *
+ * @return  void
+ */
+void HD44780_SpriteHide (HD44780_Sprite *sprite)
+{
+  // not drawn
+  if (sprite->cell == HD44780_SPRITE_HIDDEN) {
+    return;
+  }
+  // restore background
+  HD44780_PositionXY(sprite->cell, sprite->y);
+  HD44780_DrawChar(sprite->background);
+  // right cell
+  if ((sprite->cell + 1) < HD44780_COLS) {
+    HD44780_DrawChar(sprite->background);
+  }
+  // hidden
+  sprite->cell = HD44780_SPRITE_HIDDEN;
+}
+
+/**
+ * @desc    Smooth scroll compose and upload glyphs
+ *
+ * @param   HD44780_Scroll *
+ *
+ * @return  unsigned char count of sent bytes
+ */
+static unsigned char HD44780_ScrollUpload (HD44780_Scroll *scroll)
+{
+  unsigned char glyph[8];
+  unsigned char column;
+  unsigned char sent = 0;
+  unsigned char cell;
+  unsigned char bit;
+  unsigned char i;
+  unsigned int index;
+
+  // first visible column
+  index = scroll->offset;
+  // loop through cells
+  for (cell = 0; cell < scroll->width; cell++) {
+    // clear glyph
+    for (i = 0; i < 8; i++) {
+      glyph[i] = 0;
+    }
+    // loop through 5 columns of cell, bit 4 is left
+    for (bit = 0x10; bit; bit >>= 1) {
+      // pixel column
+      column = pgm_read_byte(&scroll->columns[index]);
+      // transpose column into rows
+      for (i = 0; i < 8; i++) {
+        if (column & (1 << i)) {
+          glyph[i] |= bit;
+        }
+      }
+      // next column, wrap around
+      if (++index >= scroll->length) {
+        index = 0;
+      }
+    }
+    // changed rows only
+    sent += HD44780_CGRAMUpdate(scroll->slot + cell, glyph);
+  }
+  // count of sent bytes
+  return sent;
+}
+
+/**
+ * @desc    Smooth scroll init, cells are filled with CGRAM codes
+ *
+ * @param   HD44780_Scroll *
+ * @param   unsigned char x
+ * @param   unsigned char y
+ * @param   unsigned char width {1; 2; ... 8}
+ * @param   unsigned char first CGRAM slot
+ * @param   const unsigned char * pixel columns in flash
+ * @param   unsigned int count of columns
+ *
+ * @return  char
+ */
+char HD44780_ScrollInit (HD44780_Scroll *scroll, unsigned char x, unsigned char y, unsigned char width, unsigned char slot, const unsigned char *columns, unsigned int length)
+{
+  unsigned char i;
+
+  // check slots, position and strip
+  if ((width == 0) || ((slot + width) > 8) || ((x + width) > HD44780_COLS) || (y >= HD44780_ROWS) || (length == 0)) {
+    // error
+    return ERROR;
+  }
+  // scroll
+  scroll->columns = columns;
+  scroll->length = length;
+  scroll->offset = 0;
+  scroll->x = x;
+  scroll->y = y;
+  scroll->width = width;
+  scroll->slot = slot;
+  // glyphs
+  HD44780_ScrollUpload(scroll);
+  // cells show glyphs, one set address for whole run
+  HD44780_PositionXY(x, y);
+  for (i = 0; i < width; i++) {
+    HD44780_DrawChar(slot + i);
+  }
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Smooth scroll by pixels, columns wrap around
+ *
+ * @param   HD44780_Scroll *
+ * @param   unsigned char pixels
+ *
+ * @return  unsigned char count of sent bytes
+ */
+unsigned char HD44780_ScrollStep (HD44780_Scroll *scroll, unsigned char pixels)
+{
+  // move offset, wrap around
+  scroll->offset = (scroll->offset + pixels) % scroll->length;
+  // cells already show glyphs, only CGRAM rows change
+  return HD44780_ScrollUpload(scroll);
+}
@@ -0,0 +1,110 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 CGRAM Sprites and Smooth Scroll
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_sprite.h
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h
+ * ---------------------------------------------------------------+
+ * @usage       sprite is composited every frame into 2 CGRAM glyphs,
+ *              smooth scroll into 1 glyph per cell, only glyph rows
+ *              changed since previous frame are sent
+ */
+#ifndef __HD44780_SPRITE_H__
+#define __HD44780_SPRITE_H__
+
+  #include "hd44780.h"
+
+  #if !HD44780_USE_CGRAM
+    #error "hd44780_sprite requires HD44780_USE_CGRAM"
+  #endif
+
+  // width of character in pixels
+  #define HD44780_CHAR_WIDTH      5
+  // sprite not drawn on display
+  #define HD44780_SPRITE_HIDDEN   0xFF
+
+  // sprite
+  typedef struct {
+    const unsigned char *bitmap;  // 8 rows, 5 pixels (bit 4 is left)
+    unsigned char slot;           // first of 2 CGRAM slots
+    unsigned char y;              // row
+    unsigned char cell;           // drawn cell, HD44780_SPRITE_HIDDEN
+    char background;              // char under sprite
+  } HD44780_Sprite;
+
+  // smooth scroll
+  typedef struct {
+    const unsigned char *columns; // pixel columns in flash (bit 0 is top)
+    unsigned int length;          // count of columns
+    unsigned int offset;          // first visible column
+    unsigned char x;              // left column on display
+    unsigned char y;              // row
+    unsigned char width;          // count of cells, 1 CGRAM slot per cell
+    unsigned char slot;           // first CGRAM slot
+  } HD44780_Scroll;
+
+  /**
+   * @desc    Sprite init
+   *
+   * @param   HD44780_Sprite *
+   * @param   const unsigned char * bitmap, 8 rows
+   * @param   unsigned char first of 2 CGRAM slots {0; 1; ... 6}
+   * @param   unsigned char row
+   * @param   char background
+   *
+   * @return  char
+   */
+  char HD44780_SpriteInit (HD44780_Sprite *, const unsigned char *, unsigned char, unsigned char, char);
+
+  /**
+   * @desc    Sprite move to pixel position
+   *
+   * @param   HD44780_Sprite *
+   * @param   unsigned char pixel x {0; 1; ... HD44780_COLS * 5 - 1}
+   *
+   * @return  unsigned char count of sent bytes
+   */
+  unsigned char HD44780_SpriteMove (HD44780_Sprite *, unsigned char);
+
+  /**
+   * @desc    Sprite hide, background is restored
+   *
+   * @param   HD44780_Sprite *
+   *
+   * @return  void
+   */
+  void HD44780_SpriteHide (HD44780_Sprite *);
+
+  /**
+   * @desc    Smooth scroll init, cells are filled with CGRAM codes
+   *
+   * @param   HD44780_Scroll *
+   * @param   unsigned char x
+   * @param   unsigned char y
+   * @param   unsigned char width {1; 2; ... 8}
+   * @param   unsigned char first CGRAM slot
+   * @param   const unsigned char * pixel columns in flash
+   * @param   unsigned int count of columns
+   *
+   * @return  char
+   */
+  char HD44780_ScrollInit (HD44780_Scroll *, unsigned char, unsigned char, unsigned char, unsigned char, const unsigned char *, unsigned int);
+
+  /**
+   * @desc    Smooth scroll by pixels, columns wrap around
+   *
+   * @param   HD44780_Scroll *
+   * @param   unsigned char pixels
+   *
+   * @return  unsigned char count of sent bytes
+   */
+  unsigned char HD44780_ScrollStep (HD44780_Scroll *, unsigned char);
+
+#endif
@@ -0,0 +1,300 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Update Latency Tracing
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_trace.c
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_trace.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#if defined(HD44780_LINUX)
+#include <time.h>
+#endif
+#include <avr/io.h>
+#if !defined(HD44780_LINUX)
+#include <avr/interrupt.h>
+#endif
+#include "hd44780.h"
+#include "hd44780_trace.h"
+
+// state shared with refresh interrupt, accessed with interrupts disabled
+#if defined(HD44780_LINUX)
+  #define HD44780_TRACE_LOCK(sreg)    ((sreg) = 0)
+  #define HD44780_TRACE_UNLOCK(sreg)  ((void) (sreg))
+#else
+  #define HD44780_TRACE_LOCK(sreg)    do { (sreg) = SREG; cli(); } while (0)
+  #define HD44780_TRACE_UNLOCK(sreg)  (SREG = (sreg))
+#endif
+
+// statistics
+static HD44780_TraceStats HD44780_Stats;
+// timestamp of oldest pending request
+static unsigned short int HD44780_TraceRequested;
+// timestamp of last strobed byte
+static unsigned short int HD44780_TraceLast;
+// request pending
+static unsigned char HD44780_TracePending;
+// byte strobed since request
+static unsigned char HD44780_TraceStrobed;
+// bytes since previous complete
+static unsigned char HD44780_TraceBytes;
+
+#if defined(HD44780_LINUX)
+/**
+ * @desc    Trace clock of Linux port, monotonic time in ticks
+ *
+ * @param   void
+ *
+ * @return  unsigned short int
+ */
+unsigned short int HD44780_TraceClock (void)
+{
+  struct timespec now;
+
+  // monotonic time
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  // ticks of Timer1 at _FCPU, 16 bit as TCNT1
+  return (unsigned short int) (((unsigned long long) now.tv_sec * 1000000000ULL + now.tv_nsec) * (_FCPU / 1000000UL) / 1000ULL / HD44780_TRACE_PRESCALER);
+}
+#endif
+
+/**
+ * @desc    Trace init, Timer1 runs free, statistics cleared
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_TraceInit (void)
+{
+#if !defined(HD44780_LINUX)
+  // normal mode, no interrupts
+  TCCR1A = 0;
+  TCNT1 = 0;
+  // start with prescaler
+  TCCR1B = HD44780_TRACE_CS;
+#endif
+  // clear statistics
+  HD44780_TraceReset();
+}
+
+/**
+ * @desc    Trace reset, statistics cleared, pending request dropped
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_TraceReset (void)
+{
+  unsigned char *stats = (unsigned char *) &HD44780_Stats;
+  unsigned char sreg;
+  unsigned char i;
+
+  // statistics
+  for (i = 0; i < sizeof(HD44780_Stats); i++) {
+    stats[i] = 0;
+  }
+  // state
+  HD44780_TRACE_LOCK(sreg);
+  HD44780_TracePending = 0;
+  HD44780_TraceStrobed = 0;
+  HD44780_TraceBytes = 0;
+  HD44780_TRACE_UNLOCK(sreg);
+}
+
+/**
+ * @desc    Trace request, value changed and waits for display
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_TraceRequest (void)
+{
+  unsigned char sreg;
+
+  HD44780_TRACE_LOCK(sreg);
+  // oldest request sets latency of coalesced changes
+  if (!HD44780_TracePending) {
+    HD44780_TraceRequested = HD44780_TRACE_NOW();
+    HD44780_TracePending = 1;
+    HD44780_TraceStrobed = 0;
+  }
+  HD44780_TRACE_UNLOCK(sreg);
+}
+
+/**
+ * @desc    Trace strobe, byte sent (called by driver
+ *          and refresh interrupt)
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_TraceStrobe (void)
+{
+  unsigned char sreg;
+
+  HD44780_TRACE_LOCK(sreg);
+  // time of last byte
+  HD44780_TraceLast = HD44780_TRACE_NOW();
+  HD44780_TraceStrobed = 1;
+  // saturate
+  if (HD44780_TraceBytes != 0xFF) {
+    HD44780_TraceBytes++;
+  }
+  HD44780_TRACE_UNLOCK(sreg);
+}
+
+/**
+ * @desc    Trace complete, update is on display
+ *
+ * @param   void
+ *
+ * @return  unsigned short int latency [ticks], 0 without request
+ */
+unsigned short int HD44780_TraceComplete (void)
+{
+  unsigned short int latency;
+  unsigned short int bits;
+  unsigned char bucket = 0;
+  unsigned char pending;
+  unsigned char sreg;
+
+  HD44780_TRACE_LOCK(sreg);
+  // bytes of frame, oldest overwritten
+  HD44780_Stats.frames[HD44780_Stats.frame] = HD44780_TraceBytes;
+  HD44780_Stats.frame = (HD44780_Stats.frame + 1) % HD44780_TRACE_FRAMES;
+  HD44780_TraceBytes = 0;
+  // to last strobed byte, nothing sent if content was on display
+  latency = (HD44780_TraceStrobed ? HD44780_TraceLast : HD44780_TRACE_NOW()) - HD44780_TraceRequested;
+  pending = HD44780_TracePending;
+  HD44780_TracePending = 0;
+  HD44780_TRACE_UNLOCK(sreg);
+  // no request
+  if (!pending) {
+    return 0;
+  }
+  // bucket = bit length of latency
+  for (bits = latency; bits && (bucket < (HD44780_TRACE_BUCKETS - 1)); bits >>= 1) {
+    bucket++;
+  }
+  // saturate
+  if (HD44780_Stats.histogram[bucket] != 0xFFFF) {
+    HD44780_Stats.histogram[bucket]++;
+  }
+  if (HD44780_Stats.updates != 0xFFFF) {
+    HD44780_Stats.updates++;
+  }
+  // deadline missed
+  if ((latency > HD44780_TRACE_TICKS(HD44780_TRACE_DEADLINE)) && (HD44780_Stats.late != 0xFFFF)) {
+    HD44780_Stats.late++;
+  }
+  // worst case
+  if (latency > HD44780_Stats.max) {
+    HD44780_Stats.max = latency;
+  }
+  // latency
+  return latency;
+}
+
+/**
+ * @desc    Trace statistics
+ *
+ * @param   void
+ *
+ * @return  const HD44780_TraceStats *
+ */
+const HD44780_TraceStats * HD44780_TraceGet (void)
+{
+  return &HD44780_Stats;
+}
+
+/**
+ * @desc    Trace dump text
+ *
+ * @param   void (*)(char) put char
+ * @param   const char *
+ *
+ * @return  void
+ */
+static void HD44780_TraceText (void (*put)(char), const char *text)
+{
+  // chars up to terminator
+  while (*text) {
+    put(*text++);
+  }
+}
+
+/**
+ * @desc    Trace dump unsigned decimal number
+ *
+ * @param   void (*)(char) put char
+ * @param   unsigned long
+ *
+ * @return  void
+ */
+static void HD44780_TraceNumber (void (*put)(char), unsigned long number)
+{
+  char digits[10];
+  unsigned char i = 0;
+
+  // digits from least significant
+  do {
+    digits[i++] = '0' + (number % 10);
+    number /= 10;
+  } while (number);
+  // most significant first
+  while (i) {
+    put(digits[--i]);
+  }
+}
+
+/**
+ * @desc    Trace dump as text lines, e.g. to UART
+ *
+ * @param   void (*)(char) put char
+ *
+ * @return  void
+ */
+void HD44780_TraceDump (void (*put)(char))
+{
+  unsigned char last = HD44780_TRACE_BUCKETS - 1;
+  unsigned char i;
+
+  // summary
+  HD44780_TraceText(put, "updates ");
+  HD44780_TraceNumber(put, HD44780_Stats.updates);
+  HD44780_TraceText(put, " late ");
+  HD44780_TraceNumber(put, HD44780_Stats.late);
+  HD44780_TraceText(put, " max ");
+  HD44780_TraceNumber(put, HD44780_TRACE_US(HD44780_Stats.max));
+  HD44780_TraceText(put, " us\n");
+  // non empty buckets with bound, last bucket is open
+  for (i = 0; i < HD44780_TRACE_BUCKETS; i++) {
+    if (HD44780_Stats.histogram[i]) {
+      HD44780_TraceText(put, (i == last) ? ">= " : "< ");
+      HD44780_TraceNumber(put, HD44780_TRACE_US(1UL << ((i == last) ? (i - 1) : i)));
+      HD44780_TraceText(put, " us ");
+      HD44780_TraceNumber(put, HD44780_Stats.histogram[i]);
+      put('\n');
+    }
+  }
+  // bytes of frames, oldest first
+  HD44780_TraceText(put, "bytes");
+  for (i = 0; i < HD44780_TRACE_FRAMES; i++) {
+    put(' ');
+    HD44780_TraceNumber(put, HD44780_Stats.frames[(HD44780_Stats.frame + i) % HD44780_TRACE_FRAMES]);
+  }
+  put('\n');
+}
@@ -0,0 +1,171 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Update Latency Tracing
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_trace.h
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h
+ * ---------------------------------------------------------------+
+ * @usage       build with HD44780_USE_TRACE 1, driver stamps every
+ *              byte after its last E strobe (Timer1 free running)
+ *              - HD44780_TraceRequest  value changed, oldest pending
+ *                                      request is kept
+ *              - HD44780_TraceComplete update done, latency from
+ *                                      request to last strobed byte
+ *                                      goes into log2 histogram,
+ *                                      bytes since previous complete
+ *                                      into frame ring
+ *              request and complete run in one context (main loop /
+ *              display task), bytes of background refresh are stamped
+ *              from its interrupt, shared state is accessed with
+ *              interrupts disabled, 16 bit timer wraps after 65536
+ *              ticks, longer latencies need larger prescaler
+ */
+#ifndef __HD44780_TRACE_H__
+#define __HD44780_TRACE_H__
+
+  #include "hd44780.h"
+
+  // Timer1 prescaler {1; 8; 64; 256; 1024}, 4 us tick at 16 MHz
+  #ifndef HD44780_TRACE_PRESCALER
+    #define HD44780_TRACE_PRESCALER 64
+  #endif
+
+  #if HD44780_TRACE_PRESCALER == 1
+    #define HD44780_TRACE_CS      (1 << CS10)
+  #elif HD44780_TRACE_PRESCALER == 8
+    #define HD44780_TRACE_CS      (1 << CS11)
+  #elif HD44780_TRACE_PRESCALER == 64
+    #define HD44780_TRACE_CS      ((1 << CS11) | (1 << CS10))
+  #elif HD44780_TRACE_PRESCALER == 256
+    #define HD44780_TRACE_CS      (1 << CS12)
+  #elif HD44780_TRACE_PRESCALER == 1024
+    #define HD44780_TRACE_CS      ((1 << CS12) | (1 << CS10))
+  #else
+    #error "HD44780_TRACE_PRESCALER must be 1, 8, 64, 256 or 1024"
+  #endif
+
+  // ticks of time [us] / time [us] of ticks
+  #define HD44780_TRACE_TICKS(us) ((((unsigned long) (us)) * (_FCPU / 1000000UL)) / HD44780_TRACE_PRESCALER)
+  #define HD44780_TRACE_US(ticks) ((((unsigned long) (ticks)) * HD44780_TRACE_PRESCALER) / (_FCPU / 1000000UL))
+
+  // deadline of update [us], later updates are counted
+  #ifndef HD44780_TRACE_DEADLINE
+    #define HD44780_TRACE_DEADLINE  50000
+  #endif
+
+  #if ((HD44780_TRACE_DEADLINE) * (_FCPU / 1000000UL) / HD44780_TRACE_PRESCALER) > 65535
+    #error "HD44780_TRACE_DEADLINE does not fit 16 bit timer, raise HD44780_TRACE_PRESCALER"
+  #endif
+
+  // buckets of histogram, bucket k holds latencies below 2^k ticks
+  // (bucket 0 - zero), last bucket holds rest
+  #ifndef HD44780_TRACE_BUCKETS
+    #define HD44780_TRACE_BUCKETS 16
+  #endif
+  // frames in ring of byte counts
+  #ifndef HD44780_TRACE_FRAMES
+    #define HD44780_TRACE_FRAMES  16
+  #endif
+
+  // timestamp [ticks]
+  #ifndef HD44780_TRACE_NOW
+    #if defined(HD44780_LINUX)
+      #define HD44780_TRACE_NOW() HD44780_TraceClock()
+    #else
+      #define HD44780_TRACE_NOW() TCNT1
+    #endif
+  #endif
+
+  // statistics, counters saturate
+  typedef struct {
+    unsigned short int histogram[HD44780_TRACE_BUCKETS];
+    unsigned short int updates;       // completed updates with request
+    unsigned short int late;          // updates over deadline
+    unsigned short int max;           // worst latency [ticks]
+    unsigned char frames[HD44780_TRACE_FRAMES]; // bytes per frame
+    unsigned char frame;              // next slot of frames, oldest
+  } HD44780_TraceStats;
+
+  #if defined(HD44780_LINUX)
+    /**
+     * @desc    Trace clock of Linux port, monotonic time in ticks
+     *
+     * @param   void
+     *
+     * @return  unsigned short int
+     */
+    unsigned short int HD44780_TraceClock (void);
+  #endif
+
+  /**
+   * @desc    Trace init, Timer1 runs free, statistics cleared
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_TraceInit (void);
+
+  /**
+   * @desc    Trace reset, statistics cleared, pending request dropped
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_TraceReset (void);
+
+  /**
+   * @desc    Trace request, value changed and waits for display
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_TraceRequest (void);
+
+  /**
+   * @desc    Trace strobe, byte sent (called by driver
+   *          and refresh interrupt)
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_TraceStrobe (void);
+
+  /**
+   * @desc    Trace complete, update is on display
+   *
+   * @param   void
+   *
+   * @return  unsigned short int latency [ticks], 0 without request
+   */
+  unsigned short int HD44780_TraceComplete (void);
+
+  /**
+   * @desc    Trace statistics
+   *
+   * @param   void
+   *
+   * @return  const HD44780_TraceStats *
+   */
+  const HD44780_TraceStats * HD44780_TraceGet (void);
+
+  /**
+   * @desc    Trace dump as text lines, e.g. to UART
+   *
+   * @param   void (*)(char) put char
+   *
+   * @return  void
+   */
+  void HD44780_TraceDump (void (*)(char));
+
+#endif
@@ -0,0 +1,422 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 UTF-8 to Character ROM Translation
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_utf8.c
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_utf8.h
+ * ---------------------------------------------------------------+
+ * @usage       ROM lookup is one table read in flash per block,
+ *              0 in table means code point is not in ROM
+ */
+
+// include libraries
+#include <avr/pgmspace.h>
+#include "hd44780.h"
+#include "hd44780_utf8.h"
+
+// table blocks
+#define HD44780_UTF8_LATIN1       0x00A0
+#define HD44780_UTF8_GREEK        0x0391
+#define HD44780_UTF8_GREEK_END    0x03C9
+#define HD44780_UTF8_CYRILLIC     0x0410
+#define HD44780_UTF8_CYRILLIC_END 0x042F
+#define HD44780_UTF8_KATAKANA     0xFF61
+#define HD44780_UTF8_KATAKANA_END 0xFF9F
+
+#if HD44780_ROM == HD44780_ROM_A00
+
+// Latin-1 supplement U+00A0 - U+00FF
+static const unsigned char HD44780_Utf8Latin1[96] PROGMEM = {
+  // U+00A0: nbsp  ¡     ¢     £     ¤     ¥     ¦     §
+             0x20, 0x00, 0xEC, 0xED, 0x00, 0x5C, 0x00, 0x00,
+  // U+00A8: ¨     ©     ª     «     ¬     shy   ®     ¯
+             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // U+00B0: °     ±     ²     ³     ´     µ     ¶     ·
+             0xDF, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x00, 0xA5,
+  // U+00B8: ¸     ¹     º     »     ¼     ½     ¾     ¿
+             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // U+00C0 - U+00CF
+             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // U+00D0: Ð     Ñ     Ò     Ó     Ô     Õ     Ö     ×
+             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // U+00D8: Ø     Ù     Ú     Û     Ü     Ý     Þ     ß
+             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2,
+  // U+00E0: à     á     â     ã     ä     å     æ     ç
+             0x00, 0x00, 0x00, 0x00, 0xE1, 0x00, 0x00, 0x00,
+  // U+00E8: è     é     ê     ë     ì     í     î     ï
+             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // U+00F0: ð     ñ     ò     ó     ô     õ     ö     ÷
+             0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFD,
+  // U+00F8: ø     ù     ú     û     ü     ý     þ     ÿ
+             0x00, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00
+};
+
+// Greek U+0391 - U+03C9
+static const unsigned char HD44780_Utf8Greek[57] PROGMEM = {
+  // U+0391: Α     Β     Γ     Δ     Ε     Ζ     Η     Θ
+             0x41, 0x42, 0x00, 0x00, 0x45, 0x5A, 0x48, 0xF2,
+  // U+0399: Ι     Κ     Λ     Μ     Ν     Ξ     Ο     Π
+             0x49, 0x4B, 0x00, 0x4D, 0x4E, 0x00, 0x4F, 0x00,
+  // U+03A1: Ρ     -     Σ     Τ     Υ     Φ     Χ     Ψ
+             0x50, 0x00, 0xF6, 0x54, 0x59, 0x00, 0x58, 0x00,
+  // U+03A9: Ω     Ϊ     Ϋ     ά     έ     ή     ί     ΰ
+             0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // U+03B1: α     β     γ     δ     ε     ζ     η     θ
+             0xE0, 0xE2, 0x00, 0x00, 0xE3, 0x00, 0x00, 0xF2,
+  // U+03B9: ι     κ     λ     μ     ν     ξ     ο     π
+             0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x6F, 0xF7,
+  // U+03C1: ρ     ς     σ     τ     υ     φ     χ     ψ
+             0xE6, 0x00, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // U+03C9: ω
+             0x00
+};
+
+// Cyrillic capitals U+0410 - U+042F, latin look-alikes only
+static const unsigned char HD44780_Utf8Cyrillic[32] PROGMEM = {
+  // U+0410: А     Б     В     Г     Д     Е     Ж     З
+             0x41, 0x00, 0x42, 0x00, 0x00, 0x45, 0x00, 0x00,
+  // U+0418: И     Й     К     Л     М     Н     О     П
+             0x00, 0x00, 0x4B, 0x00, 0x4D, 0x48, 0x4F, 0x00,
+  // U+0420: Р     С     Т     У     Ф     Х     Ц     Ч
+             0x50, 0x43, 0x54, 0x00, 0x00, 0x58, 0x00, 0x00,
+  // U+0428: Ш     Щ     Ъ     Ы     Ь     Э     Ю     Я
+             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+#elif HD44780_ROM == HD44780_ROM_A02
+
+// Greek U+0391 - U+03C9
+static const unsigned char HD44780_Utf8Greek[57] PROGMEM = {
+  // U+0391: Α     Β     Γ     Δ     Ε     Ζ     Η     Θ
+             0x41, 0x42, 0x92, 0x00, 0x45, 0x5A, 0x48, 0x99,
+  // U+0399: Ι     Κ     Λ     Μ     Ν     Ξ     Ο     Π
+             0x49, 0x4B, 0x00, 0x4D, 0x4E, 0x00, 0x4F, 0x00,
+  // U+03A1: Ρ     -     Σ     Τ     Υ     Φ     Χ     Ψ
+             0x50, 0x00, 0x94, 0x54, 0x59, 0x00, 0x58, 0x00,
+  // U+03A9: Ω     Ϊ     Ϋ     ά     έ     ή     ί     ΰ
+             0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // U+03B1: α     β     γ     δ     ε     ζ     η     θ
+             0x90, 0xDF, 0x00, 0x9B, 0x9E, 0x00, 0x00, 0x00,
+  // U+03B9: ι     κ     λ     μ     ν     ξ     ο     π
+             0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x6F, 0x93,
+  // U+03C1: ρ     ς     σ     τ     υ     φ     χ     ψ
+             0x00, 0x00, 0x95, 0x97, 0x00, 0x00, 0x00, 0x00,
+  // U+03C9: ω
+             0x00
+};
+
+// Cyrillic capitals U+0410 - U+042F
+static const unsigned char HD44780_Utf8Cyrillic[32] PROGMEM = {
+  // U+0410: А     Б     В     Г     Д     Е     Ж     З
+             0x41, 0x80, 0x42, 0x92, 0x81, 0x45, 0x82, 0x83,
+  // U+0418: И     Й     К     Л     М     Н     О     П
+             0x84, 0x85, 0x4B, 0x86, 0x4D, 0x48, 0x4F, 0x87,
+  // U+0420: Р     С     Т     У     Ф     Х     Ц     Ч
+             0x50, 0x43, 0x54, 0x88, 0x00, 0x58, 0x89, 0x8A,
+  // U+0428: Ш     Щ     Ъ     Ы     Ь     Э     Ю     Я
+             0x8B, 0x8C, 0x8D, 0x8E, 0x62, 0x8F, 0x00, 0x00
+};
+
+#else
+  #error "HD44780_ROM must be HD44780_ROM_A00 or HD44780_ROM_A02"
+#endif
+
+// glyph for CGRAM
+typedef struct {
+  unsigned short int code;    // code point
+  unsigned char rows[8];      // 5x8 bitmap
+} HD44780_Utf8Glyph;
+
+// glyphs of code points missing in ROM, sorted by code point
+static const HD44780_Utf8Glyph HD44780_Utf8Glyphs[] PROGMEM = {
+  { 0x005C, { 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00 } }, // '\'
+  { 0x007E, { 0x00, 0x00, 0x08, 0x15, 0x02, 0x00, 0x00, 0x00 } }, // '~'
+  { 0x00E1, { 0x02, 0x04, 0x0E, 0x01, 0x0F, 0x11, 0x0F, 0x00 } }, // á
+  { 0x00E9, { 0x02, 0x04, 0x0E, 0x11, 0x1F, 0x10, 0x0E, 0x00 } }, // é
+  { 0x00ED, { 0x02, 0x04, 0x0C, 0x04, 0x04, 0x04, 0x0E, 0x00 } }, // í
+  { 0x00F3, { 0x02, 0x04, 0x0E, 0x11, 0x11, 0x11, 0x0E, 0x00 } }, // ó
+  { 0x00F4, { 0x04, 0x0A, 0x0E, 0x11, 0x11, 0x11, 0x0E, 0x00 } }, // ô
+  { 0x00FA, { 0x02, 0x04, 0x11, 0x11, 0x11, 0x13, 0x0D, 0x00 } }, // ú
+  { 0x00FD, { 0x02, 0x04, 0x11, 0x11, 0x0F, 0x01, 0x0E, 0x00 } }, // ý
+  { 0x010C, { 0x0A, 0x04, 0x0E, 0x11, 0x10, 0x11, 0x0E, 0x00 } }, // Č
+  { 0x010D, { 0x0A, 0x04, 0x0E, 0x10, 0x10, 0x11, 0x0E, 0x00 } }, // č
+  { 0x010F, { 0x03, 0x01, 0x0D, 0x13, 0x11, 0x11, 0x0F, 0x00 } }, // ď
+  { 0x013E, { 0x0D, 0x05, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00 } }, // ľ
+  { 0x0148, { 0x0A, 0x04, 0x16, 0x19, 0x11, 0x11, 0x11, 0x00 } }, // ň
+  { 0x0160, { 0x0A, 0x04, 0x0F, 0x10, 0x0E, 0x01, 0x1E, 0x00 } }, // Š
+  { 0x0161, { 0x0A, 0x04, 0x0E, 0x10, 0x0E, 0x01, 0x1E, 0x00 } }, // š
+  { 0x0165, { 0x09, 0x09, 0x1C, 0x08, 0x08, 0x09, 0x06, 0x00 } }, // ť
+  { 0x017D, { 0x0A, 0x04, 0x1F, 0x02, 0x04, 0x08, 0x1F, 0x00 } }, // Ž
+  { 0x017E, { 0x0A, 0x04, 0x00, 0x1F, 0x02, 0x04, 0x1F, 0x00 } }, // ž
+  { 0x2190, { 0x00, 0x04, 0x08, 0x1F, 0x08, 0x04, 0x00, 0x00 } }, // ←
+  { 0x2192, { 0x00, 0x04, 0x02, 0x1F, 0x02, 0x04, 0x00, 0x00 } }, // →
+  { 0x2588, { 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F } }  // █
+};
+
+// count of glyphs
+#define HD44780_UTF8_GLYPHS (sizeof(HD44780_Utf8Glyphs) / sizeof(HD44780_Utf8Glyphs[0]))
+
+// code points loaded in CGRAM slots, 0 = empty, content is checked
+// against shadow, slot overwritten by other module is evicted
+static unsigned short int HD44780_Utf8Slots[HD44780_UTF8_SLOTS];
+// next slot to replace
+static unsigned char HD44780_Utf8Next = 0;
+
+/**
+ * @desc    Code point to character ROM code
+ *
+ * @param   unsigned long code point
+ *
+ * @return  unsigned char ROM code, 0 if not in ROM
+ */
+unsigned char HD44780_Utf8ToRom (unsigned long code)
+{
+#if HD44780_ROM == HD44780_ROM_A00
+  // ASCII, backslash and tilde are yen and arrow in A00
+  if ((code >= 0x20) && (code < 0x7E) && (code != 0x5C)) {
+    return (unsigned char) code;
+  }
+  // Latin-1 supplement
+  if ((code >= HD44780_UTF8_LATIN1) && (code <= 0xFF)) {
+    return pgm_read_byte(&HD44780_Utf8Latin1[code - HD44780_UTF8_LATIN1]);
+  }
+  // half width katakana maps linearly to 0xA1 - 0xDF
+  if ((code >= HD44780_UTF8_KATAKANA) && (code <= HD44780_UTF8_KATAKANA_END)) {
+    return (unsigned char) (code - HD44780_UTF8_KATAKANA + 0xA1);
+  }
+#else
+  // ASCII
+  if ((code >= 0x20) && (code < 0x7F)) {
+    return (unsigned char) code;
+  }
+  // no-break space
+  if (code == HD44780_UTF8_LATIN1) {
+    return ' ';
+  }
+  // Latin-1 supplement is at the same position in A02
+  if ((code > HD44780_UTF8_LATIN1) && (code <= 0xFF)) {
+    return (unsigned char) code;
+  }
+#endif
+  // Greek
+  if ((code >= HD44780_UTF8_GREEK) && (code <= HD44780_UTF8_GREEK_END)) {
+    return pgm_read_byte(&HD44780_Utf8Greek[code - HD44780_UTF8_GREEK]);
+  }
+  // Cyrillic
+  if ((code >= HD44780_UTF8_CYRILLIC) && (code <= HD44780_UTF8_CYRILLIC_END)) {
+    return pgm_read_byte(&HD44780_Utf8Cyrillic[code - HD44780_UTF8_CYRILLIC]);
+  }
+#if HD44780_ROM == HD44780_ROM_A00
+  // symbols
+  switch (code) {
+    case 0x2190: return 0x7F;   // ←
+    case 0x2192: return 0x7E;   // →
+    case 0x221A: return 0xE8;   // √
+    case 0x221E: return 0xF3;   // ∞
+    case 0x2588: return 0xFF;   // █
+  }
+#else
+  // symbols
+  switch (code) {
+    case 0x221E: return 0x9C;   // ∞
+    case 0x266A: return 0x91;   // ♪
+  }
+#endif
+  // not in ROM
+  return 0;
+}
+
+/**
+ * @desc    Find glyph of code point
+ *
+ * @param   unsigned long code point
+ *
+ * @return  const HD44780_Utf8Glyph * in flash, 0 if not found
+ */
+static const HD44780_Utf8Glyph * HD44780_Utf8FindGlyph (unsigned long code)
+{
+  unsigned char low = 0;
+  unsigned char high = HD44780_UTF8_GLYPHS;
+  unsigned char mid;
+  unsigned short int glyph;
+
+  // only BMP code points in table
+  if (code > 0xFFFF) {
+    return 0;
+  }
+  // binary search
+  while (low < high) {
+    mid = (low + high) >> 1;
+    glyph = pgm_read_word(&HD44780_Utf8Glyphs[mid].code);
+    // found
+    if (glyph == code) {
+      return &HD44780_Utf8Glyphs[mid];
+    }
+    // halve interval
+    if (glyph < code) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  // not found
+  return 0;
+}
+
+/**
+ * @desc    Check if CGRAM slot holds glyph, by shadow
+ *
+ * @param   unsigned char slot {0; 1; ... 7}
+ * @param   const unsigned char * 8 rows
+ *
+ * @return  unsigned char 1 if loaded
+ */
+static unsigned char HD44780_Utf8Loaded (unsigned char slot, const unsigned char *rows)
+{
+  unsigned char i;
+
+  // unknown content
+  if (!(HD44780_CGRAMValid & (1 << slot))) {
+    return 0;
+  }
+  // compare rows
+  for (i = 0; i < 8; i++) {
+    if (HD44780_CGRAMShadow[(slot << 3) + i] != rows[i]) {
+      return 0;
+    }
+  }
+  // loaded
+  return 1;
+}
+
+/**
+ * @desc    Code point to display code, CGRAM is loaded if needed
+ *
+ * @param   unsigned long code point
+ *
+ * @return  unsigned char
+ */
+unsigned char HD44780_Utf8ToCode (unsigned long code)
+{
+  const HD44780_Utf8Glyph *glyph;
+  unsigned char rows[8];
+  unsigned char slot;
+  unsigned char i;
+
+  // character ROM
+  slot = HD44780_Utf8ToRom(code);
+  if (slot) {
+    return slot;
+  }
+  // glyph for CGRAM
+  glyph = HD44780_Utf8FindGlyph(code);
+  if (!glyph) {
+    return HD44780_UTF8_UNKNOWN;
+  }
+  // copy bitmap from flash
+  for (i = 0; i < 8; i++) {
+    rows[i] = pgm_read_byte(&glyph->rows[i]);
+  }
+  // already loaded
+  for (slot = 0; slot < HD44780_UTF8_SLOTS; slot++) {
+    if (HD44780_Utf8Slots[slot] == code) {
+      // glyph still in CGRAM
+      if (HD44780_Utf8Loaded(HD44780_UTF8_SLOT_FIRST + slot, rows)) {
+        return HD44780_UTF8_SLOT_FIRST + slot;
+      }
+      // overwritten by other module - evicted, cells of other
+      // module are kept, glyph is allocated again
+      HD44780_Utf8Slots[slot] = 0;
+      break;
+    }
+  }
+  // free slot with unknown content first
+  for (slot = 0; slot < HD44780_UTF8_SLOTS; slot++) {
+    if (!HD44780_Utf8Slots[slot] && !(HD44780_CGRAMValid & (1 << (HD44780_UTF8_SLOT_FIRST + slot)))) {
+      break;
+    }
+  }
+  // replace slots in round robin
+  if (slot >= HD44780_UTF8_SLOTS) {
+    slot = HD44780_Utf8Next;
+    if (++HD44780_Utf8Next >= HD44780_UTF8_SLOTS) {
+      HD44780_Utf8Next = 0;
+    }
+  }
+  // load CGRAM, only rows differing from shadow
+  HD44780_CGRAMUpdate(HD44780_UTF8_SLOT_FIRST + slot, rows);
+  // remember code point
+  HD44780_Utf8Slots[slot] = (unsigned short int) code;
+  // CGRAM code
+  return HD44780_UTF8_SLOT_FIRST + slot;
+}
+
+/**
+ * @desc    Decode one UTF-8 sequence
+ *
+ * @param   const char ** pointer into string, moved behind sequence
+ *
+ * @return  unsigned long code point
+ */
+unsigned long HD44780_Utf8Decode (const char **str)
+{
+  const unsigned char *s = (const unsigned char *) *str;
+  unsigned long code;
+  unsigned char count;
+
+  // lead byte
+  if (*s < 0x80) {
+    code = *s++;
+    count = 0;
+  } else if ((*s & 0xE0) == 0xC0) {
+    code = *s++ & 0x1F;
+    count = 1;
+  } else if ((*s & 0xF0) == 0xE0) {
+    code = *s++ & 0x0F;
+    count = 2;
+  } else if ((*s & 0xF8) == 0xF0) {
+    code = *s++ & 0x07;
+    count = 3;
+  } else {
+    // invalid lead byte
+    *str = (const char *) (s + 1);
+    return HD44780_UTF8_UNKNOWN;
+  }
+  // continuation bytes
+  while (count--) {
+    // truncated sequence, string end is not consumed
+    if ((*s & 0xC0) != 0x80) {
+      *str = (const char *) s;
+      return HD44780_UTF8_UNKNOWN;
+    }
+    code = (code << 6) | (*s++ & 0x3F);
+  }
+  // move behind sequence
+  *str = (const char *) s;
+  // code point
+  return code;
+}
+
+/**
+ * @desc    LCD draw UTF-8 string
+ *
+ * @param   const char *
+ *
+ * @return  void
+ */
+void HD44780_DrawStringUtf8 (const char *str)
+{
+  // loop through string
+  while (*str != '\0') {
+    // decode and translate
+    HD44780_SendData(HD44780_Utf8ToCode(HD44780_Utf8Decode(&str)));
+  }
+}
@@ -0,0 +1,81 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 UTF-8 to Character ROM Translation
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_utf8.h
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h
+ * ---------------------------------------------------------------+
+ * @usage       character ROM selected by HD44780_ROM in hd44780.h,
+ *              code points missing in ROM are loaded on demand
+ *              into CGRAM slots HD44780_UTF8_SLOT_FIRST ...
+ */
+#ifndef __HD44780_UTF8_H__
+#define __HD44780_UTF8_H__
+
+  #include "hd44780.h"
+
+  #if !HD44780_USE_CGRAM
+    #error "hd44780_utf8 requires HD44780_USE_CGRAM"
+  #endif
+
+  // first CGRAM slot used for missing code points, default slot 7
+  // is free of bars (0-3) and big digits (4-6) packs, icons pack,
+  // sprites and scrolls need own slots out of range
+  #ifndef HD44780_UTF8_SLOT_FIRST
+    #define HD44780_UTF8_SLOT_FIRST   7
+  #endif
+  // count of CGRAM slots used for missing code points
+  #ifndef HD44780_UTF8_SLOTS
+    #define HD44780_UTF8_SLOTS        1
+  #endif
+
+  #if (HD44780_UTF8_SLOTS == 0) || ((HD44780_UTF8_SLOT_FIRST + HD44780_UTF8_SLOTS) > 8)
+    #error "HD44780_UTF8_SLOT_FIRST + HD44780_UTF8_SLOTS must fit 8 CGRAM slots"
+  #endif
+  // char drawn if code point has no glyph
+  #define HD44780_UTF8_UNKNOWN        '?'
+
+  /**
+   * @desc    Code point to character ROM code
+   *
+   * @param   unsigned long code point
+   *
+   * @return  unsigned char ROM code, 0 if not in ROM
+   */
+  unsigned char HD44780_Utf8ToRom (unsigned long);
+
+  /**
+   * @desc    Code point to display code, CGRAM is loaded if needed
+   *
+   * @param   unsigned long code point
+   *
+   * @return  unsigned char
+   */
+  unsigned char HD44780_Utf8ToCode (unsigned long);
+
+  /**
+   * @desc    Decode one UTF-8 sequence
+   *
+   * @param   const char ** pointer into string, moved behind sequence
+   *
+   * @return  unsigned long code point
+   */
+  unsigned long HD44780_Utf8Decode (const char **);
+
+  /**
+   * @desc    LCD draw UTF-8 string
+   *
+   * @param   const char *
+   *
+   * @return  void
+   */
+  void HD44780_DrawStringUtf8 (const char *);
+
+#endif
@@ -0,0 +1,227 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Text Windows
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_window.c
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780_shadow.h, hd44780_window.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#include "hd44780_shadow.h"
+#include "hd44780_window.h"
+
+/**
+ * @desc    Window scroll one row up
+ *
+ * @param   HD44780_Window *
+ *
+ * @return  void
+ */
+static void HD44780_WindowScroll (HD44780_Window *win)
+{
+  unsigned char x;
+  unsigned char y;
+
+  // move rows up
+  for (y = win->y; y < (win->y + win->height - 1); y++) {
+    for (x = win->x; x < (win->x + win->width); x++) {
+      HD44780_Frame[y][x] = HD44780_Frame[y + 1][x];
+    }
+  }
+  // clear last row
+  for (x = win->x; x < (win->x + win->width); x++) {
+    HD44780_Frame[y][x] = ' ';
+  }
+}
+
+/**
+ * @desc    Window new line
+ *
+ * @param   HD44780_Window *
+ *
+ * @return  void
+ */
+static void HD44780_WindowNewLine (HD44780_Window *win)
+{
+  // first column
+  win->cx = 0;
+  // last row reached
+  if ((win->cy + 1) >= win->height) {
+    // scroll enabled
+    if (win->flags & HD44780_WIN_SCROLL) {
+      // scroll content, cursor stays on last row
+      HD44780_WindowScroll(win);
+      return;
+    }
+  }
+  // next row, beyond last row output is clipped
+  if (win->cy < win->height) {
+    win->cy++;
+  }
+}
+
+/**
+ * @desc    Window init
+ *
+ * @param   HD44780_Window *
+ * @param   unsigned char x
+ * @param   unsigned char y
+ * @param   unsigned char width
+ * @param   unsigned char height
+ * @param   unsigned char flags {HD44780_WIN_CLIP; HD44780_WIN_WRAP; HD44780_WIN_SCROLL}
+ *
+ * @return  char
+ */
+char HD44780_WindowInit (HD44780_Window *win, unsigned char x, unsigned char y, unsigned char width, unsigned char height, unsigned char flags)
+{
+  // check window fits into display
+  if ((width == 0) || (height == 0) || ((x + width) > HD44780_COLS) || ((y + height) > HD44780_ROWS)) {
+    // error
+    return ERROR;
+  }
+  // rectangle
+  win->x = x;
+  win->y = y;
+  win->width = width;
+  win->height = height;
+  // behaviour
+  win->flags = flags;
+  // cursor home
+  win->cx = 0;
+  win->cy = 0;
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Window clear and cursor home
+ *
+ * @param   HD44780_Window *
+ *
+ * @return  void
+ */
+void HD44780_WindowClear (HD44780_Window *win)
+{
+  unsigned char x;
+  unsigned char y;
+
+  // clear window rectangle
+  for (y = win->y; y < (win->y + win->height); y++) {
+    for (x = win->x; x < (win->x + win->width); x++) {
+      HD44780_Frame[y][x] = ' ';
+    }
+  }
+  // cursor home
+  win->cx = 0;
+  win->cy = 0;
+}
+
+/**
+ * @desc    Window go to position x, y
+ *
+ * @param   HD44780_Window *
+ * @param   unsigned char x
+ * @param   unsigned char y
+ *
+ * @return  char
+ */
+char HD44780_WindowPositionXY (HD44780_Window *win, unsigned char x, unsigned char y)
+{
+  // check position inside window
+  if ((x >= win->width) || (y >= win->height)) {
+    // error
+    return ERROR;
+  }
+  // set cursor
+  win->cx = x;
+  win->cy = y;
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Window draw char
+ *
+ * @param   HD44780_Window *
+ * @param   char
+ *
+ * @return  char ERROR if char was clipped
+ */
+char HD44780_WindowDrawChar (HD44780_Window *win, char character)
+{
+  // new line
+  if (character == '\n') {
+    HD44780_WindowNewLine(win);
+    return SUCCESS;
+  }
+  // carriage return
+  if (character == '\r') {
+    win->cx = 0;
+    return SUCCESS;
+  }
+  // right edge reached, wrap is deferred until next char
+  // so filling of last cell does not scroll the window
+  if (win->cx >= win->width) {
+    // clip
+    if (!(win->flags & HD44780_WIN_WRAP)) {
+      return ERROR;
+    }
+    // wrap
+    HD44780_WindowNewLine(win);
+  }
+  // below last row
+  if (win->cy >= win->height) {
+    // clip
+    return ERROR;
+  }
+  // compose into shadow frame
+  HD44780_Frame[win->y + win->cy][win->x + win->cx] = character;
+  // move cursor
+  win->cx++;
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Window draw string
+ *
+ * @param   HD44780_Window *
+ * @param   char *
+ *
+ * @return  char ERROR if any char was clipped
+ */
+char HD44780_WindowDrawString (HD44780_Window *win, char *str)
+{
+  char status = SUCCESS;
+  unsigned char i = 0;
+
+  // loop through string
+  while (str[i] != '\0') {
+    // draw char and remember clipping
+    status |= HD44780_WindowDrawChar(win, str[i++]);
+  }
+  // status
+  return status;
+}
+
+/**
+ * @desc    Window flush - send all windows in one pass
+ *
+ * @param   void
+ *
+ * @return  unsigned char count of sent bytes
+ */
+unsigned char HD44780_WindowFlush (void)
+{
+  // windows share shadow frame, fields in one row go in one run
+  return HD44780_ShadowFlush();
+}
@@ -0,0 +1,103 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Text Windows
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_window.h
+ * @tested      AVR Atmega16a
+ *
+ * @depend      hd44780.h, hd44780_shadow.h
+ * ---------------------------------------------------------------+
+ * @usage       every window has own cursor, draws are clipped to
+ *              window rectangle and composed into HD44780_Frame,
+ *              HD44780_WindowFlush sends all windows at once
+ */
+#ifndef __HD44780_WINDOW_H__
+#define __HD44780_WINDOW_H__
+
+  #include "hd44780_shadow.h"
+
+  // window flags
+  #define HD44780_WIN_CLIP        0x00
+  #define HD44780_WIN_WRAP        0x01
+  #define HD44780_WIN_SCROLL      0x02
+
+  // window
+  typedef struct {
+    unsigned char x;        // left column on display
+    unsigned char y;        // top row on display
+    unsigned char width;    // count of columns
+    unsigned char height;   // count of rows
+    unsigned char cx;       // cursor column in window
+    unsigned char cy;       // cursor row in window
+    unsigned char flags;    // HD44780_WIN_WRAP | HD44780_WIN_SCROLL
+  } HD44780_Window;
+
+  /**
+   * @desc    Window init
+   *
+   * @param   HD44780_Window *
+   * @param   unsigned char x
+   * @param   unsigned char y
+   * @param   unsigned char width
+   * @param   unsigned char height
+   * @param   unsigned char flags {HD44780_WIN_CLIP; HD44780_WIN_WRAP; HD44780_WIN_SCROLL}
+   *
+   * @return  char
+   */
+  char HD44780_WindowInit (HD44780_Window *, unsigned char, unsigned char, unsigned char, unsigned char, unsigned char);
+
+  /**
+   * @desc    Window clear and cursor home
+   *
+   * @param   HD44780_Window *
+   *
+   * @return  void
+   */
+  void HD44780_WindowClear (HD44780_Window *);
+
+  /**
+   * @desc    Window go to position x, y
+   *
+   * @param   HD44780_Window *
+   * @param   unsigned char x
+   * @param   unsigned char y
+   *
+   * @return  char
+   */
+  char HD44780_WindowPositionXY (HD44780_Window *, unsigned char, unsigned char);
+
+  /**
+   * @desc    Window draw char
+   *
+   * @param   HD44780_Window *
+   * @param   char
+   *
+   * @return  char ERROR if char was clipped
+   */
+  char HD44780_WindowDrawChar (HD44780_Window *, char);
+
+  /**
+   * @desc    Window draw string
+   *
+   * @param   HD44780_Window *
+   * @param   char *
+   *
+   * @return  char ERROR if any char was clipped
+   */
+  char HD44780_WindowDrawString (HD44780_Window *, char *);
+
+  /**
+   * @desc    Window flush - send all windows in one pass
+   *
+   * @param   void
+   *
+   * @return  unsigned char count of sent bytes
+   */
+  unsigned char HD44780_WindowFlush (void);
+
+#endif
@@ -0,0 +1,26 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        AVR EEPROM of Linux Port
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        eeprom.h
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend
+ * ---------------------------------------------------------------+
+ * @usage       replaces <avr/eeprom.h> when built with -Ilinux,
+ *              EEPROM tables are ordinary const data
+ */
+#ifndef __HD44780_AVR_EEPROM_H__
+#define __HD44780_AVR_EEPROM_H__
+
+  // no separate address space
+  #define EEMEM
+  // read from EEPROM
+  #define eeprom_read_byte(p)   (*(const unsigned char *) (p))
+
+#endif
@@ -0,0 +1,23 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        AVR I/O Registers of Linux Port
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        io.h
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend      hd44780_gpio.h
+ * ---------------------------------------------------------------+
+ * @usage       replaces <avr/io.h> when built with -Ilinux
+ */
+#ifndef __HD44780_AVR_IO_H__
+#define __HD44780_AVR_IO_H__
+
+  // registers emulated by GPIO layer
+  #include "hd44780_gpio.h"
+
+#endif
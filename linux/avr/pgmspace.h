@@ -0,0 +1,29 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        AVR Program Space of Linux Port
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        pgmspace.h
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend
+ * ---------------------------------------------------------------+
+ * @usage       replaces <avr/pgmspace.h> when built with -Ilinux,
+ *              flash tables are ordinary const data
+ */
+#ifndef __HD44780_AVR_PGMSPACE_H__
+#define __HD44780_AVR_PGMSPACE_H__
+
+  // no separate address space
+  #define PROGMEM
+  #define PSTR(s)               (s)
+  // read from flash
+  #define pgm_read_byte(p)      (*(const unsigned char *) (p))
+  #define pgm_read_word(p)      (*(const unsigned short int *) (p))
+  #define pgm_read_ptr(p)       (*(const void * const *) (p))
+
+#endif
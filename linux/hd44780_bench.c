@@ -0,0 +1,216 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Linux Port - Queue Throughput Benchmark
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_bench.c
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend      hd44780.h, hd44780_mpsc.h, hd44780_linux.h,
+ *              hd44780_sim.h
+ * ---------------------------------------------------------------+
+ * @usage       hd44780_bench [threads] [messages per thread]
+ *              1. queue - producers against consumer popping only
+ *              2. bus   - producers against bus owner driving
+ *                         simulated display
+ */
+
+// include libraries
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "hd44780.h"
+#include "hd44780_mpsc.h"
+#include "hd44780_linux.h"
+#include "hd44780_sim.h"
+
+// max count of producers
+#define BENCH_THREADS_MAX         64
+
+// producer
+typedef struct {
+  pthread_t thread;
+  unsigned char id;
+  unsigned long messages;
+  unsigned long retries;
+} Bench_Producer;
+
+// queue of phase 1
+static HD44780_Mpsc Bench_Queue;
+// phase 1 - consumer stops after all messages
+static unsigned long Bench_Total;
+// phase 2 - submit to bus owner instead of queue
+static unsigned char Bench_Bus;
+
+/**
+ * @desc    Time now [ns]
+ *
+ * @param   void
+ *
+ * @return  double
+ */
+static double Bench_Now (void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/**
+ * @desc    Producer thread, full queue is retried
+ *
+ * @param   void * Bench_Producer
+ *
+ * @return  void *
+ */
+static void *Bench_Produce (void *arg)
+{
+  Bench_Producer *producer = arg;
+  HD44780_Msg msg;
+  char text[8];
+  unsigned long i;
+
+  // counter text in column of thread
+  msg.type = HD44780_MSG_TEXT;
+  for (i = 0; i < producer->messages; i++) {
+    snprintf(text, sizeof(text), "%c%lu", 'A' + producer->id, i % 100);
+    // bus owner
+    if (Bench_Bus) {
+      while (HD44780_LinuxText((producer->id * 4) % HD44780_COLS, (producer->id / 4) % HD44780_ROWS, text) == ERROR) {
+        producer->retries++;
+        sched_yield();
+      }
+    // queue only
+    } else {
+      snprintf(msg.text, sizeof(msg.text), "%s", text);
+      while (HD44780_MpscPush(&Bench_Queue, &msg) == ERROR) {
+        producer->retries++;
+        sched_yield();
+      }
+    }
+  }
+  return NULL;
+}
+
+/**
+ * @desc    Consumer thread of phase 1
+ *
+ * @param   void *
+ *
+ * @return  void *
+ */
+static void *Bench_Consume (void *arg)
+{
+  unsigned long received = 0;
+  HD44780_Msg msg;
+
+  // all messages
+  while (received < Bench_Total) {
+    if (HD44780_MpscPop(&Bench_Queue, &msg) == SUCCESS) {
+      received++;
+    // empty
+    } else {
+      sched_yield();
+    }
+  }
+  return arg;
+}
+
+/**
+ * @desc    Run producers, return elapsed time [ns]
+ *
+ * @param   Bench_Producer *
+ * @param   unsigned int threads
+ *
+ * @return  double
+ */
+static double Bench_Run (Bench_Producer *producers, unsigned int threads)
+{
+  double start = Bench_Now();
+  unsigned int i;
+
+  for (i = 0; i < threads; i++) {
+    pthread_create(&producers[i].thread, NULL, Bench_Produce, &producers[i]);
+  }
+  for (i = 0; i < threads; i++) {
+    pthread_join(producers[i].thread, NULL);
+  }
+  return Bench_Now() - start;
+}
+
+/**
+ * @desc    Main
+ *
+ * @param   int
+ * @param   char **
+ *
+ * @return  int
+ */
+int main (int argc, char **argv)
+{
+  Bench_Producer producers[BENCH_THREADS_MAX];
+  unsigned int threads = (argc > 1) ? atoi(argv[1]) : 4;
+  unsigned long messages = (argc > 2) ? strtoul(argv[2], NULL, 10) : 1000000UL;
+  unsigned long retries;
+  pthread_t consumer;
+  double elapsed;
+  unsigned int i;
+
+  // check arguments
+  if ((threads == 0) || (threads > BENCH_THREADS_MAX) || (messages == 0)) {
+    fprintf(stderr, "usage: %s [threads 1-%d] [messages per thread]\n", argv[0], BENCH_THREADS_MAX);
+    return EXIT_FAILURE;
+  }
+
+  // 1. queue
+  // ------------------------------------------
+  for (i = 0; i < threads; i++) {
+    producers[i] = (Bench_Producer) { .id = i, .messages = messages };
+  }
+  HD44780_MpscInit(&Bench_Queue);
+  Bench_Total = threads * messages;
+  Bench_Bus = 0;
+  pthread_create(&consumer, NULL, Bench_Consume, NULL);
+  elapsed = Bench_Run(producers, threads);
+  pthread_join(consumer, NULL);
+  elapsed = (elapsed > 0) ? elapsed : 1;
+  for (retries = 0, i = 0; i < threads; i++) {
+    retries += producers[i].retries;
+  }
+  printf("queue: %u producers, %lu messages, %.1f ns/msg, %.2f Mmsg/s, %lu full retries\n",
+         threads, Bench_Total, elapsed / Bench_Total, Bench_Total * 1e3 / elapsed, retries);
+
+  // 2. bus owner with simulated display
+  // ------------------------------------------
+  for (i = 0; i < threads; i++) {
+    producers[i] = (Bench_Producer) { .id = i, .messages = messages };
+  }
+  Bench_Bus = 1;
+  if (HD44780_LinuxStart(&HD44780_GpioSim) == ERROR) {
+    fprintf(stderr, "GPIO open failed\n");
+    return EXIT_FAILURE;
+  }
+  elapsed = Bench_Run(producers, threads);
+  HD44780_LinuxStop();
+  elapsed = (elapsed > 0) ? elapsed : 1;
+  for (retries = 0, i = 0; i < threads; i++) {
+    retries += producers[i].retries;
+  }
+  printf("bus:   %u producers, %lu messages, %.1f ns/msg, %lu full retries\n",
+         threads, HD44780_LinuxStat.messages, elapsed / HD44780_LinuxStat.messages, retries);
+  printf("       %lu flushes, %lu bytes on bus, %.3f s of bus time at F_CPU\n",
+         HD44780_LinuxStat.flushes, HD44780_LinuxStat.bytes, (double) HD44780_Sim.cycles / _FCPU);
+
+  // content of display
+  for (i = 0; i < HD44780_ROWS; i++) {
+    printf("       |%.*s|\n", HD44780_COLS, (char *) &HD44780_Sim.ddram[i ? HD44780_ROW2_START : HD44780_ROW1_START]);
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,420 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Bus Capture and VCD Export of Linux Port
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_capture.c
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend      hd44780.h, hd44780_gpio.h, hd44780_capture.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#include <stdio.h>
+#include "hd44780.h"
+#include "hd44780_gpio.h"
+#include "hd44780_capture.h"
+
+// timestamp [ps] of cycles
+#define HD44780_CAPTURE_PS(cycles) ((unsigned long long) (cycles) * (1000000000000ULL / _FCPU))
+// time [ns] to [ps]
+#define HD44780_CAPTURE_NS(ns)    ((unsigned long long) (ns) * 1000ULL)
+// count of traced pins
+#define HD44780_CAPTURE_PINS      7
+// level of pin
+#define HD44780_CAPTURE_PIN(byte, pin) (((byte) >> (pin)) & 1)
+
+// captured events
+HD44780_CaptureState HD44780_Capture;
+
+// backend driven through capture
+static const HD44780_GpioOps *HD44780_CaptureGpio = &HD44780_GpioSim;
+
+// traced pins, VCD identifiers '!' + index
+static const unsigned char HD44780_CapturePins[HD44780_CAPTURE_PINS] = {
+  HD44780_E, HD44780_RS, HD44780_RW,
+  HD44780_DATA4, HD44780_DATA5, HD44780_DATA6, HD44780_DATA7
+};
+static const char *HD44780_CaptureNames[HD44780_CAPTURE_PINS] = {
+  "E", "RS", "RW", "DB4", "DB5", "DB6", "DB7"
+};
+// data pins
+#define HD44780_CAPTURE_DATA      ((1 << HD44780_DATA7) | (1 << HD44780_DATA6) | (1 << HD44780_DATA5) | (1 << HD44780_DATA4))
+
+/**
+ * @desc    Capture store event
+ *
+ * @param   unsigned char kind
+ * @param   unsigned char pin
+ * @param   unsigned char level
+ *
+ * @return  void
+ */
+static void HD44780_CaptureStore (unsigned char kind, unsigned char pin, unsigned char level)
+{
+  HD44780_CaptureEvent *event;
+
+  // buffer full
+  if (HD44780_Capture.count >= HD44780_CAPTURE_SIZE) {
+    HD44780_Capture.lost++;
+    return;
+  }
+  // event
+  event = &HD44780_Capture.events[HD44780_Capture.count++];
+  event->cycles = HD44780_Capture.cycles;
+  event->kind = kind;
+  event->pin = pin;
+  event->level = level;
+}
+
+/**
+ * @desc    Capture select backend driven through capture,
+ *          call before HD44780_GpioSelect(&HD44780_GpioCapture)
+ *
+ * @param   const HD44780_GpioOps *
+ *
+ * @return  void
+ */
+void HD44780_CaptureSelect (const HD44780_GpioOps *ops)
+{
+  HD44780_CaptureGpio = ops;
+}
+
+/**
+ * @desc    Capture open - events cleared, clock restarted
+ *
+ * @param   void
+ *
+ * @return  char
+ */
+static char HD44780_CaptureOpen (void)
+{
+  // empty capture
+  HD44780_Capture.count = 0;
+  HD44780_Capture.lost = 0;
+  HD44780_Capture.cycles = 0;
+  // request pins of backend
+  return HD44780_CaptureGpio->open();
+}
+
+/**
+ * @desc    Capture close
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void HD44780_CaptureClose (void)
+{
+  HD44780_CaptureGpio->close();
+}
+
+/**
+ * @desc    Capture direction of pin
+ *
+ * @param   unsigned char pin
+ * @param   unsigned char output
+ *
+ * @return  void
+ */
+static void HD44780_CaptureDirection (unsigned char pin, unsigned char output)
+{
+  // sbi / cbi, pin changes at the end of instruction
+  HD44780_Capture.cycles += HD44780_CYC_SBI;
+  HD44780_CaptureStore(HD44780_CAPTURE_DIR, pin, output);
+  HD44780_CaptureGpio->direction(pin, output);
+}
+
+/**
+ * @desc    Capture write pin
+ *
+ * @param   unsigned char pin
+ * @param   unsigned char level
+ *
+ * @return  void
+ */
+static void HD44780_CaptureWrite (unsigned char pin, unsigned char level)
+{
+  // sbi / cbi, pin changes at the end of instruction
+  HD44780_Capture.cycles += HD44780_CYC_SBI;
+  HD44780_CaptureStore(HD44780_CAPTURE_WRITE, pin, level);
+  HD44780_CaptureGpio->write(pin, level);
+}
+
+/**
+ * @desc    Capture read pins
+ *
+ * @param   unsigned char mask of input pins
+ *
+ * @return  unsigned char
+ */
+static unsigned char HD44780_CaptureRead (unsigned char mask)
+{
+  unsigned char levels;
+
+  // in
+  HD44780_Capture.cycles += HD44780_CYC_IN;
+  levels = HD44780_CaptureGpio->read(mask);
+  HD44780_CaptureStore(HD44780_CAPTURE_READ, mask, levels);
+  // levels of inputs
+  return levels;
+}
+
+/**
+ * @desc    Capture delay
+ *
+ * @param   unsigned long cycles
+ *
+ * @return  void
+ */
+static void HD44780_CaptureDelay (unsigned long cycles)
+{
+  HD44780_Capture.cycles += cycles;
+  HD44780_CaptureGpio->delay(cycles);
+}
+
+// GPIO recording into HD44780_Capture
+const HD44780_GpioOps HD44780_GpioCapture = {
+  HD44780_CaptureOpen,
+  HD44780_CaptureClose,
+  HD44780_CaptureDirection,
+  HD44780_CaptureWrite,
+  HD44780_CaptureRead,
+  HD44780_CaptureDelay
+};
+
+/**
+ * @desc    Capture VCD value of traced pin
+ *
+ * @param   FILE *
+ * @param   unsigned char index of traced pin
+ * @param   char value {'0'; '1'; 'z'}
+ *
+ * @return  void
+ */
+static void HD44780_CaptureVcdValue (FILE *file, unsigned char index, char value)
+{
+  fprintf(file, "%c%c\n", value, '!' + index);
+}
+
+/**
+ * @desc    Capture export as Value Change Dump
+ *
+ * @param   const char * path
+ *
+ * @return  char
+ */
+char HD44780_CaptureVcd (const char *path)
+{
+  FILE *file = fopen(path, "w");
+  HD44780_CaptureEvent *event;
+  unsigned long long time = 0;
+  unsigned char outputs = 0;
+  unsigned char pins = 0;
+  unsigned char pin;
+  unsigned long i;
+  unsigned char j;
+
+  // file
+  if (file == NULL) {
+    // error
+    return ERROR;
+  }
+  // header, 1 cycle = integer count of ps
+  fprintf(file, "$version HD44780 capture, %lu Hz $end\n", (unsigned long) _FCPU);
+  fprintf(file, "$timescale 1 ps $end\n");
+  fprintf(file, "$scope module hd44780 $end\n");
+  for (j = 0; j < HD44780_CAPTURE_PINS; j++) {
+    fprintf(file, "$var wire 1 %c %s $end\n", '!' + j, HD44780_CaptureNames[j]);
+  }
+  fprintf(file, "$var event 1 %c SAMPLE $end\n", '!' + HD44780_CAPTURE_PINS);
+  fprintf(file, "$upscope $end\n$enddefinitions $end\n");
+  // reset state, pins are inputs
+  fprintf(file, "#0\n$dumpvars\n");
+  for (j = 0; j < HD44780_CAPTURE_PINS; j++) {
+    HD44780_CaptureVcdValue(file, j, 'z');
+  }
+  fprintf(file, "$end\n");
+  // loop through events
+  for (i = 0; i < HD44780_Capture.count; i++) {
+    event = &HD44780_Capture.events[i];
+    // new timestamp
+    if (HD44780_CAPTURE_PS(event->cycles) != time) {
+      time = HD44780_CAPTURE_PS(event->cycles);
+      fprintf(file, "#%llu\n", time);
+    }
+    // sample, levels of inputs driven by controller
+    if (event->kind == HD44780_CAPTURE_READ) {
+      fprintf(file, "1%c\n", '!' + HD44780_CAPTURE_PINS);
+      for (j = 0; j < HD44780_CAPTURE_PINS; j++) {
+        pin = HD44780_CapturePins[j];
+        if ((event->pin >> pin) & 1) {
+          HD44780_CaptureVcdValue(file, j, '0' + HD44780_CAPTURE_PIN(event->level, pin));
+        }
+      }
+      continue;
+    }
+    // state of pin
+    if (event->kind == HD44780_CAPTURE_DIR) {
+      outputs = event->level ? (outputs | (1 << event->pin)) : (outputs & ~(1 << event->pin));
+    } else {
+      pins = event->level ? (pins | (1 << event->pin)) : (pins & ~(1 << event->pin));
+    }
+    // traced pin
+    for (j = 0; j < HD44780_CAPTURE_PINS; j++) {
+      if (HD44780_CapturePins[j] == event->pin) {
+        HD44780_CaptureVcdValue(file, j, HD44780_CAPTURE_PIN(outputs, event->pin) ? '0' + HD44780_CAPTURE_PIN(pins, event->pin) : 'z');
+      }
+    }
+    // end of read cycle, controller releases bus
+    if ((event->pin == HD44780_E) && !event->level) {
+      for (j = 3; j < HD44780_CAPTURE_PINS; j++) {
+        if (!HD44780_CAPTURE_PIN(outputs, HD44780_CapturePins[j])) {
+          HD44780_CaptureVcdValue(file, j, 'z');
+        }
+      }
+    }
+  }
+  // close
+  if (fclose(file) != 0) {
+    // error
+    return ERROR;
+  }
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Capture report violation
+ *
+ * @param   FILE * report
+ * @param   unsigned long long time [ps]
+ * @param   const char * name of parameter
+ * @param   unsigned long long measured [ps]
+ * @param   unsigned long limit [ns]
+ *
+ * @return  unsigned long 1
+ */
+static unsigned long HD44780_CaptureViolation (FILE *report, unsigned long long time, const char *name, unsigned long long measured, unsigned long limit)
+{
+  if (report != NULL) {
+    fprintf(report, "%14.3f us  %-5s %8.1f ns < %lu ns\n", time / 1000000.0, name, measured / 1000.0, limit);
+  }
+  // one violation
+  return 1;
+}
+
+/**
+ * @desc    Capture check timing against HD44780_CHECK_T_* -
+ *          tAS, PWeh, tH, tcycE and tDDR of reads, idle gaps
+ *          over HD44780_CAPTURE_GAP are reported
+ *
+ * @param   FILE * report, NULL - no report
+ *
+ * @return  unsigned long count of violations
+ */
+unsigned long HD44780_CaptureCheck (FILE *report)
+{
+  HD44780_CaptureEvent *event;
+  unsigned long long address = 0;   // last change of RS / RW
+  unsigned long long rise = 0;      // last E rising edge
+  unsigned long long fall = 0;      // last E falling edge
+  unsigned long long idle = 0;      // sum of idle gaps
+  unsigned long long time;
+  unsigned long violations = 0;
+  unsigned long strobes = 0;
+  unsigned long gaps = 0;
+  unsigned char write = 0;          // last strobe wrote to controller
+  unsigned char outputs = 0;
+  unsigned char pins = 0;
+  unsigned char changed;
+  unsigned long i;
+
+  // loop through events
+  for (i = 0; i < HD44780_Capture.count; i++) {
+    event = &HD44780_Capture.events[i];
+    time = HD44780_CAPTURE_PS(event->cycles);
+    // read sample, PIN synchronizer latches one cycle before in
+    if (event->kind == HD44780_CAPTURE_READ) {
+      if (HD44780_CAPTURE_PIN(pins, HD44780_E) && HD44780_CAPTURE_PIN(pins, HD44780_RW) &&
+         ((time - HD44780_CAPTURE_PS(HD44780_CYC_IN + HD44780_CYC_SYNC) - rise) < HD44780_CAPTURE_NS(HD44780_CHECK_T_DDR))) {
+        violations += HD44780_CaptureViolation(report, time, "tDDR", time - HD44780_CAPTURE_PS(HD44780_CYC_IN + HD44780_CYC_SYNC) - rise, HD44780_CHECK_T_DDR);
+      }
+      continue;
+    }
+    // direction of data pin, bus released or taken after write
+    if (event->kind == HD44780_CAPTURE_DIR) {
+      changed = HD44780_CAPTURE_PIN(outputs, event->pin) != event->level;
+      outputs = event->level ? (outputs | (1 << event->pin)) : (outputs & ~(1 << event->pin));
+      if (changed && ((1 << event->pin) & HD44780_CAPTURE_DATA) && write && fall &&
+         ((time - fall) < HD44780_CAPTURE_NS(HD44780_CHECK_T_H))) {
+        violations += HD44780_CaptureViolation(report, time, "tH", time - fall, HD44780_CHECK_T_H);
+      }
+      continue;
+    }
+    // level of pin
+    changed = HD44780_CAPTURE_PIN(pins, event->pin) != event->level;
+    pins = event->level ? (pins | (1 << event->pin)) : (pins & ~(1 << event->pin));
+    if (!changed) {
+      continue;
+    }
+    // E rising edge
+    if ((event->pin == HD44780_E) && event->level) {
+      // RS, RW set up
+      if ((time - address) < HD44780_CAPTURE_NS(HD44780_CHECK_T_AS)) {
+        violations += HD44780_CaptureViolation(report, time, "tAS", time - address, HD44780_CHECK_T_AS);
+      }
+      // enable cycle
+      if (strobes && ((time - rise) < HD44780_CAPTURE_NS(HD44780_CHECK_T_CYCE))) {
+        violations += HD44780_CaptureViolation(report, time, "tcycE", time - rise, HD44780_CHECK_T_CYCE);
+      }
+      // bus idle since last strobe
+      if (strobes && ((time - fall) >= HD44780_CAPTURE_NS(HD44780_CAPTURE_GAP))) {
+        gaps++;
+        idle += time - fall;
+        if (report != NULL) {
+          fprintf(report, "%14.3f us  idle  %8.3f us\n", time / 1000000.0, (time - fall) / 1000000.0);
+        }
+      }
+      rise = time;
+    // E falling edge
+    } else if (event->pin == HD44780_E) {
+      // enable pulse width
+      if ((time - rise) < HD44780_CAPTURE_NS(HD44780_CHECK_T_PWEH)) {
+        violations += HD44780_CaptureViolation(report, time, "PWeh", time - rise, HD44780_CHECK_T_PWEH);
+      }
+      write = !HD44780_CAPTURE_PIN(pins, HD44780_RW);
+      fall = time;
+      strobes++;
+    // RS, RW - stable while E high, held after E falls
+    } else if ((event->pin == HD44780_RS) || (event->pin == HD44780_RW)) {
+      if (HD44780_CAPTURE_PIN(pins, HD44780_E)) {
+        violations += HD44780_CaptureViolation(report, time, "tAS", 0, HD44780_CHECK_T_AS);
+      } else if (strobes && ((time - fall) < HD44780_CAPTURE_NS(HD44780_CHECK_T_H))) {
+        violations += HD44780_CaptureViolation(report, time, "tH", time - fall, HD44780_CHECK_T_H);
+      }
+      address = time;
+    // driven data held after E falls in write
+    } else if (((1 << event->pin) & HD44780_CAPTURE_DATA) & outputs) {
+      if (write && strobes && !HD44780_CAPTURE_PIN(pins, HD44780_E) && ((time - fall) < HD44780_CAPTURE_NS(HD44780_CHECK_T_H))) {
+        violations += HD44780_CaptureViolation(report, time, "tH", time - fall, HD44780_CHECK_T_H);
+      }
+    }
+  }
+  // summary
+  if (report != NULL) {
+    fprintf(report, "events %lu (lost %lu), strobes %lu, span %.3f us\n",
+            HD44780_Capture.count, HD44780_Capture.lost, strobes,
+            HD44780_Capture.count ? HD44780_CAPTURE_PS(HD44780_Capture.events[HD44780_Capture.count - 1].cycles) / 1000000.0 : 0.0);
+    fprintf(report, "idle gaps over %u ns: %lu, %.3f us\n", HD44780_CAPTURE_GAP, gaps, idle / 1000000.0);
+    fprintf(report, "violations: %lu\n", violations);
+  }
+  // count of violations
+  return violations;
+}
@@ -0,0 +1,115 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Bus Capture and VCD Export of Linux Port
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_capture.h
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend      hd44780_gpio.h
+ * ---------------------------------------------------------------+
+ * @usage       HD44780_GpioCapture is put between driver and GPIO
+ *              backend, every pin write, direction change and read
+ *              sample is stored with timestamp of virtual clock of
+ *              _FCPU counted like on AVR (sbi / cbi 2, in 1, delay),
+ *              e.g.
+ *              HD44780_CaptureSelect(&HD44780_GpioSim);
+ *              HD44780_GpioSelect(&HD44780_GpioCapture);
+ *              capture is exported as VCD (GTKWave, PulseView) and
+ *              checked against timing characteristics of hd44780.h
+ */
+#ifndef __HD44780_CAPTURE_H__
+#define __HD44780_CAPTURE_H__
+
+  #include <stdio.h>
+  #include "hd44780_gpio.h"
+
+  // max count of events, later events are lost
+  #ifndef HD44780_CAPTURE_SIZE
+    #define HD44780_CAPTURE_SIZE  65536
+  #endif
+  // idle gap between E strobes reported by checker [ns]
+  #ifndef HD44780_CAPTURE_GAP
+    #define HD44780_CAPTURE_GAP   10000
+  #endif
+
+  // limits of checker [ns], datasheet values independent of
+  // HD44780_T_* used by driver, so tuned driver is checked
+  #ifndef HD44780_CHECK_T_AS
+    #define HD44780_CHECK_T_AS    60
+  #endif
+  #ifndef HD44780_CHECK_T_PWEH
+    #define HD44780_CHECK_T_PWEH  450
+  #endif
+  #ifndef HD44780_CHECK_T_CYCE
+    #define HD44780_CHECK_T_CYCE  1000
+  #endif
+  #ifndef HD44780_CHECK_T_DDR
+    #define HD44780_CHECK_T_DDR   360
+  #endif
+  #ifndef HD44780_CHECK_T_H
+    #define HD44780_CHECK_T_H     10
+  #endif
+
+  // kinds of events
+  #define HD44780_CAPTURE_WRITE   0   // pin, level
+  #define HD44780_CAPTURE_DIR     1   // pin, 1 - output
+  #define HD44780_CAPTURE_READ    2   // pin = mask, level = levels
+
+  // event
+  typedef struct {
+    unsigned long long cycles;      // end of instruction changing pin
+    unsigned char kind;             // HD44780_CAPTURE_*
+    unsigned char pin;              // pin / mask of read
+    unsigned char level;            // level / levels of read
+  } HD44780_CaptureEvent;
+
+  // capture
+  typedef struct {
+    HD44780_CaptureEvent events[HD44780_CAPTURE_SIZE];
+    unsigned long count;            // stored events
+    unsigned long lost;             // events over HD44780_CAPTURE_SIZE
+    unsigned long long cycles;      // virtual clock of _FCPU
+  } HD44780_CaptureState;
+
+  // captured events, cleared by open
+  extern HD44780_CaptureState HD44780_Capture;
+
+  // GPIO recording into HD44780_Capture
+  extern const HD44780_GpioOps HD44780_GpioCapture;
+
+  /**
+   * @desc    Capture select backend driven through capture,
+   *          call before HD44780_GpioSelect(&HD44780_GpioCapture)
+   *
+   * @param   const HD44780_GpioOps *
+   *
+   * @return  void
+   */
+  void HD44780_CaptureSelect (const HD44780_GpioOps *);
+
+  /**
+   * @desc    Capture export as Value Change Dump
+   *
+   * @param   const char * path
+   *
+   * @return  char
+   */
+  char HD44780_CaptureVcd (const char *);
+
+  /**
+   * @desc    Capture check timing against HD44780_CHECK_T_* -
+   *          tAS, PWeh, tH, tcycE and tDDR of reads, idle gaps
+   *          over HD44780_CAPTURE_GAP are reported
+   *
+   * @param   FILE * report, NULL - no report
+   *
+   * @return  unsigned long count of violations
+   */
+  unsigned long HD44780_CaptureCheck (FILE *);
+
+#endif
@@ -0,0 +1,104 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Linux Port - Regression Checks
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_check.c
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend      hd44780.h, hd44780_batch.h, hd44780_sim.h
+ * ---------------------------------------------------------------+
+ * @usage       hd44780_check
+ *              drives simulated display through sequences of past
+ *              bugs and compares DDRAM with expected content,
+ *              exit status 1 on mismatch
+ */
+
+// include libraries
+#include <stdio.h>
+#include <string.h>
+#include "hd44780.h"
+#include "hd44780_batch.h"
+#include "hd44780_sim.h"
+
+/**
+ * @desc    Compare row of simulated DDRAM
+ *
+ * @param   const char * name of check
+ * @param   unsigned char y
+ * @param   const char * expected row, HD44780_COLS chars
+ *
+ * @return  unsigned char 1 on mismatch
+ */
+static unsigned char HD44780_CheckRow (const char *name, unsigned char y, const char *expected)
+{
+  char row[HD44780_COLS + 1];
+  unsigned char x;
+
+  // DDRAM of row
+  for (x = 0; x < HD44780_COLS; x++) {
+    row[x] = HD44780_Sim.ddram[(y ? HD44780_ROW2_START : HD44780_ROW1_START) + x];
+  }
+  row[HD44780_COLS] = '\0';
+  // compare
+  if (strcmp(row, expected) != 0) {
+    printf("FAIL %s: |%s| expected |%s|\n", name, row, expected);
+    return 1;
+  }
+  printf("ok   %s\n", name);
+  return 0;
+}
+
+/**
+ * @desc    Batch commit followed by reposition, set address after
+ *          commit must not be dropped by moves of previous batch
+ *
+ * @param   void
+ *
+ * @return  unsigned char 1 on mismatch
+ */
+static unsigned char HD44780_CheckBatchReposition (void)
+{
+  // fresh display
+  HD44780_Init();
+  HD44780_DisplayOn();
+  // first batch ends with move
+  HD44780_BatchBegin();
+  HD44780_BatchPositionXY(0, 0);
+  HD44780_BatchString("ab");
+  HD44780_BatchPositionXY(5, 0);
+  HD44780_BatchCommit();
+  // second batch moves back before data
+  HD44780_BatchPositionXY(2, 0);
+  HD44780_BatchString("c");
+  HD44780_BatchCommit();
+  // c in column 2
+  return HD44780_CheckRow("batch commit, reposition", 0, "abc             ");
+}
+
+/**
+ * @desc    Main
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  unsigned char failed = 0;
+
+  // simulated display
+  if (HD44780_GpioSelect(&HD44780_GpioSim) == ERROR) {
+    fprintf(stderr, "gpio select failed\n");
+    return 1;
+  }
+  // checks
+  failed += HD44780_CheckBatchReposition();
+  HD44780_GpioRelease();
+  // exit status
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,135 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 GPIO Layer of Linux Port
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_gpio.c
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend      hd44780.h, hd44780_gpio.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#include <stddef.h>
+#include "hd44780.h"
+#include "hd44780_gpio.h"
+
+// emulated registers
+volatile unsigned char PORTD = 0;
+volatile unsigned char DDRD = 0;
+
+// selected backend
+static const HD44780_GpioOps *HD44780_Gpio = NULL;
+
+/**
+ * @desc    GPIO select backend and request pins
+ *
+ * @param   const HD44780_GpioOps *
+ *
+ * @return  char
+ */
+char HD44780_GpioSelect (const HD44780_GpioOps *ops)
+{
+  // release previous backend
+  HD44780_GpioRelease();
+  // all pins input, low (AVR reset state)
+  PORTD = 0;
+  DDRD = 0;
+  // request pins
+  if ((ops == NULL) || (ops->open() == ERROR)) {
+    // error
+    return ERROR;
+  }
+  // selected
+  HD44780_Gpio = ops;
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    GPIO release pins of selected backend
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_GpioRelease (void)
+{
+  // nothing selected
+  if (HD44780_Gpio == NULL) {
+    return;
+  }
+  // release pins
+  HD44780_Gpio->close();
+  HD44780_Gpio = NULL;
+}
+
+/**
+ * @desc    GPIO write bit of PORT / DDR register
+ *
+ * @param   volatile unsigned char * register
+ * @param   unsigned char bit
+ * @param   unsigned char level
+ *
+ * @return  void
+ */
+void HD44780_GpioWrite (volatile unsigned char *reg, unsigned char bit, unsigned char level)
+{
+  // register keeps value for read back
+  if (level) {
+    *reg |= (1 << bit);
+  } else {
+    *reg &= ~(1 << bit);
+  }
+  // no backend selected, register only
+  if (HD44780_Gpio == NULL) {
+    return;
+  }
+  // direction
+  if (reg == &DDRD) {
+    HD44780_Gpio->direction(bit, level);
+  // level, backend ignores pull up of input
+  } else {
+    HD44780_Gpio->write(bit, level);
+  }
+}
+
+/**
+ * @desc    GPIO read PIN register
+ *
+ * @param   void
+ *
+ * @return  unsigned char
+ */
+unsigned char HD44780_GpioRead (void)
+{
+  // no backend selected, inputs read low (busy flag clear)
+  if (HD44780_Gpio == NULL) {
+    return PORTD & DDRD;
+  }
+  // outputs from PORT, inputs from backend
+  return (PORTD & DDRD) | HD44780_Gpio->read(~DDRD);
+}
+
+/**
+ * @desc    GPIO delay
+ *
+ * @param   unsigned long cycles of _FCPU
+ *
+ * @return  void
+ */
+void HD44780_GpioDelay (unsigned long cycles)
+{
+  // no backend selected, nothing to wait for
+  if (HD44780_Gpio == NULL) {
+    return;
+  }
+  // backend waits or advances virtual clock
+  HD44780_Gpio->delay(cycles);
+}
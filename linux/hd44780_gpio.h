@@ -0,0 +1,91 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 GPIO Layer of Linux Port
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_gpio.h
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend
+ * ---------------------------------------------------------------+
+ * @usage       driver keeps AVR register access (PORTD, DDRD, PIND),
+ *              registers are emulated and every bit change is passed
+ *              to selected backend (HD44780_GpioSim, HD44780_GpioSysfs),
+ *              without backend only registers are updated
+ */
+#ifndef __HD44780_GPIO_H__
+#define __HD44780_GPIO_H__
+
+  // virtual port D, bit number is pin of backend
+  extern volatile unsigned char PORTD;
+  extern volatile unsigned char DDRD;
+  // read of pins
+  #define PIND                  HD44780_GpioRead()
+
+  // GPIO backend
+  typedef struct {
+    char (*open) (void);                              // request pins
+    void (*close) (void);                             // release pins
+    void (*direction) (unsigned char, unsigned char); // pin, 1 - output
+    void (*write) (unsigned char, unsigned char);     // pin, level
+    unsigned char (*read) (unsigned char);            // levels of pins in mask
+    void (*delay) (unsigned long);                    // cycles of _FCPU
+  } HD44780_GpioOps;
+
+  // simulated GPIO with HD44780 controller model
+  extern const HD44780_GpioOps HD44780_GpioSim;
+  // sysfs GPIO (/sys/class/gpio)
+  extern const HD44780_GpioOps HD44780_GpioSysfs;
+
+  /**
+   * @desc    GPIO select backend and request pins
+   *
+   * @param   const HD44780_GpioOps *
+   *
+   * @return  char
+   */
+  char HD44780_GpioSelect (const HD44780_GpioOps *);
+
+  /**
+   * @desc    GPIO release pins of selected backend
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_GpioRelease (void);
+
+  /**
+   * @desc    GPIO write bit of PORT / DDR register
+   *
+   * @param   volatile unsigned char * register
+   * @param   unsigned char bit
+   * @param   unsigned char level
+   *
+   * @return  void
+   */
+  void HD44780_GpioWrite (volatile unsigned char *, unsigned char, unsigned char);
+
+  /**
+   * @desc    GPIO read PIN register
+   *
+   * @param   void
+   *
+   * @return  unsigned char
+   */
+  unsigned char HD44780_GpioRead (void);
+
+  /**
+   * @desc    GPIO delay
+   *
+   * @param   unsigned long cycles of _FCPU
+   *
+   * @return  void
+   */
+  void HD44780_GpioDelay (unsigned long);
+
+#endif
@@ -0,0 +1,220 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Linux Port - Bus Owner Thread
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_linux.c
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend      hd44780.h, hd44780_shadow.h, hd44780_gpio.h,
+ *              hd44780_mpsc.h, hd44780_linux.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "hd44780.h"
+#include "hd44780_shadow.h"
+#include "hd44780_gpio.h"
+#include "hd44780_mpsc.h"
+#include "hd44780_linux.h"
+
+// statistics
+HD44780_LinuxStats HD44780_LinuxStat;
+
+// submission queue
+static HD44780_Mpsc HD44780_LinuxQueue;
+// bus owner
+static pthread_t HD44780_LinuxThread;
+
+/**
+ * @desc    Linux flush shadow frame if changed
+ *
+ * @param   unsigned char * dirty flag
+ *
+ * @return  void
+ */
+static void HD44780_LinuxFlush (unsigned char *dirty)
+{
+  // nothing written since last flush
+  if (!*dirty) {
+    return;
+  }
+  // changed cells only
+  HD44780_LinuxStat.bytes += HD44780_ShadowFlush();
+  HD44780_LinuxStat.flushes++;
+  *dirty = 0;
+}
+
+/**
+ * @desc    Linux bus owner thread
+ *
+ * @param   void *
+ *
+ * @return  void *
+ */
+static void *HD44780_LinuxOwner (void *arg)
+{
+  struct timespec sleep = { 0, HD44780_LINUX_SLEEP * 1000L };
+  unsigned char dirty = 0;
+  unsigned int idle = 0;
+  HD44780_Msg msg;
+  unsigned char i;
+
+  // display
+  HD44780_Init();
+  HD44780_DisplayOn();
+  HD44780_ShadowInit();
+
+  while (1) {
+    // queue empty
+    if (HD44780_MpscPop(&HD44780_LinuxQueue, &msg) == ERROR) {
+      // burst finished
+      if (dirty) {
+        HD44780_LinuxFlush(&dirty);
+        continue;
+      }
+      // spin, then sleep
+      if (++idle < HD44780_LINUX_SPIN) {
+        sched_yield();
+      } else {
+        nanosleep(&sleep, NULL);
+      }
+      continue;
+    }
+    idle = 0;
+    // stop
+    if (msg.type == HD44780_MSG_STOP) {
+      HD44780_LinuxFlush(&dirty);
+      break;
+    }
+    HD44780_LinuxStat.messages++;
+    // text into frame
+    if (msg.type == HD44780_MSG_TEXT) {
+      for (i = 0; (msg.text[i] != '\0') && ((msg.x + i) < HD44780_COLS); i++) {
+        HD44780_Frame[msg.y][msg.x + i] = msg.text[i];
+      }
+      dirty = 1;
+    // display clear drops pending frame
+    } else if ((msg.type == HD44780_MSG_COMMAND) && (msg.x == HD44780_DISP_CLEAR)) {
+      HD44780_SendInstruction(HD44780_DISP_CLEAR);
+      HD44780_ShadowInit();
+      HD44780_LinuxStat.bytes++;
+      dirty = 0;
+    // command after earlier text
+    } else {
+      HD44780_LinuxFlush(&dirty);
+      HD44780_SendInstruction(msg.x);
+      HD44780_LinuxStat.bytes++;
+    }
+  }
+  return arg;
+}
+
+/**
+ * @desc    Linux start - select GPIO, run bus owner thread
+ *          (display init, display on, shadow init)
+ *
+ * @param   const HD44780_GpioOps *
+ *
+ * @return  char
+ */
+char HD44780_LinuxStart (const HD44780_GpioOps *ops)
+{
+  // empty queue and statistics
+  HD44780_MpscInit(&HD44780_LinuxQueue);
+  HD44780_LinuxStat.messages = 0;
+  HD44780_LinuxStat.flushes = 0;
+  HD44780_LinuxStat.bytes = 0;
+  // request pins
+  if (HD44780_GpioSelect(ops) == ERROR) {
+    // error
+    return ERROR;
+  }
+  // bus owner
+  if (pthread_create(&HD44780_LinuxThread, NULL, HD44780_LinuxOwner, NULL) != 0) {
+    HD44780_GpioRelease();
+    // error
+    return ERROR;
+  }
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Linux stop - queued messages are processed, pins released
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HD44780_LinuxStop (void)
+{
+  HD44780_Msg msg;
+
+  // stop after queued messages
+  msg.type = HD44780_MSG_STOP;
+  while (HD44780_MpscPush(&HD44780_LinuxQueue, &msg) == ERROR) {
+    sched_yield();
+  }
+  pthread_join(HD44780_LinuxThread, NULL);
+  // release pins
+  HD44780_GpioRelease();
+}
+
+/**
+ * @desc    Linux submit instruction, any thread
+ *
+ * @param   unsigned char
+ *
+ * @return  char ERROR if queue is full
+ */
+char HD44780_LinuxCommand (unsigned char instruction)
+{
+  HD44780_Msg msg;
+
+  // instruction
+  msg.type = HD44780_MSG_COMMAND;
+  msg.x = instruction;
+  // lock-free
+  return HD44780_MpscPush(&HD44780_LinuxQueue, &msg);
+}
+
+/**
+ * @desc    Linux submit text at x, y, any thread,
+ *          text is clipped at end of row
+ *
+ * @param   unsigned char x
+ * @param   unsigned char y
+ * @param   const char * up to HD44780_MPSC_TEXT chars
+ *
+ * @return  char ERROR if queue is full or position is out of display
+ */
+char HD44780_LinuxText (unsigned char x, unsigned char y, const char *text)
+{
+  HD44780_Msg msg;
+  unsigned char i;
+
+  // check position
+  if ((x >= HD44780_COLS) || (y >= HD44780_ROWS)) {
+    // error
+    return ERROR;
+  }
+  // text
+  msg.type = HD44780_MSG_TEXT;
+  msg.x = x;
+  msg.y = y;
+  for (i = 0; (text[i] != '\0') && (i < HD44780_MPSC_TEXT); i++) {
+    msg.text[i] = text[i];
+  }
+  msg.text[i] = '\0';
+  // lock-free
+  return HD44780_MpscPush(&HD44780_LinuxQueue, &msg);
+}
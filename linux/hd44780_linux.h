@@ -0,0 +1,86 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Linux Port - Bus Owner Thread
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_linux.h
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend      hd44780_gpio.h, hd44780_mpsc.h
+ * ---------------------------------------------------------------+
+ * @usage       only bus owner thread calls driver, application
+ *              threads submit messages through lock-free queue:
+ *              - text is written into shadow frame, frame is flushed
+ *                when queue runs empty (bursts are coalesced)
+ *              - command is sent after pending frame is flushed
+ */
+#ifndef __HD44780_LINUX_H__
+#define __HD44780_LINUX_H__
+
+  #include "hd44780_gpio.h"
+  #include "hd44780_mpsc.h"
+
+  // empty polls of queue before bus owner sleeps
+  #ifndef HD44780_LINUX_SPIN
+    #define HD44780_LINUX_SPIN    64
+  #endif
+  // sleep of idle bus owner [us]
+  #ifndef HD44780_LINUX_SLEEP
+    #define HD44780_LINUX_SLEEP   200
+  #endif
+
+  // statistics of bus owner
+  typedef struct {
+    unsigned long messages;       // processed messages
+    unsigned long flushes;        // shadow flushes
+    unsigned long bytes;          // instructions and data bytes sent
+  } HD44780_LinuxStats;
+
+  // statistics, valid after HD44780_LinuxStop
+  extern HD44780_LinuxStats HD44780_LinuxStat;
+
+  /**
+   * @desc    Linux start - select GPIO, run bus owner thread
+   *          (display init, display on, shadow init)
+   *
+   * @param   const HD44780_GpioOps *
+   *
+   * @return  char
+   */
+  char HD44780_LinuxStart (const HD44780_GpioOps *);
+
+  /**
+   * @desc    Linux stop - queued messages are processed, pins released
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HD44780_LinuxStop (void);
+
+  /**
+   * @desc    Linux submit instruction, any thread
+   *
+   * @param   unsigned char
+   *
+   * @return  char ERROR if queue is full
+   */
+  char HD44780_LinuxCommand (unsigned char);
+
+  /**
+   * @desc    Linux submit text at x, y, any thread,
+   *          text is clipped at end of row
+   *
+   * @param   unsigned char x
+   * @param   unsigned char y
+   * @param   const char * up to HD44780_MPSC_TEXT chars
+   *
+   * @return  char ERROR if queue is full or position is out of display
+   */
+  char HD44780_LinuxText (unsigned char, unsigned char, const char *);
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Lock-free MPSC Queue of Linux Port
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_mpsc.c
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend      hd44780.h, hd44780_mpsc.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#include "hd44780.h"
+#include "hd44780_mpsc.h"
+
+/**
+ * @desc    MPSC init, not thread safe
+ *
+ * @param   HD44780_Mpsc *
+ *
+ * @return  void
+ */
+void HD44780_MpscInit (HD44780_Mpsc *queue)
+{
+  unsigned long i;
+
+  // every cell ready for its first position
+  for (i = 0; i < HD44780_MPSC_SIZE; i++) {
+    atomic_init(&queue->cells[i].sequence, i);
+  }
+  // empty
+  atomic_init(&queue->head, 0);
+  queue->tail = 0;
+}
+
+/**
+ * @desc    MPSC push, any thread
+ *
+ * @param   HD44780_Mpsc *
+ * @param   const HD44780_Msg *
+ *
+ * @return  char ERROR if queue is full
+ */
+char HD44780_MpscPush (HD44780_Mpsc *queue, const HD44780_Msg *msg)
+{
+  HD44780_MpscCell *cell;
+  unsigned long position;
+  unsigned long sequence;
+  long diff;
+
+  // position to claim
+  position = atomic_load_explicit(&queue->head, memory_order_relaxed);
+  while (1) {
+    cell = &queue->cells[position & (HD44780_MPSC_SIZE - 1)];
+    sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+    diff = (long) (sequence - position);
+    // cell free - claim position, failed CAS reloads position
+    if (diff == 0) {
+      if (atomic_compare_exchange_weak_explicit(&queue->head, &position, position + 1, memory_order_relaxed, memory_order_relaxed)) {
+        break;
+      }
+    // cell not consumed yet - full
+    } else if (diff < 0) {
+      // error
+      return ERROR;
+    // other producer claimed position
+    } else {
+      position = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    }
+  }
+  // store message
+  cell->msg = *msg;
+  // publish to consumer
+  atomic_store_explicit(&cell->sequence, position + 1, memory_order_release);
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    MPSC pop, consumer thread only
+ *
+ * @param   HD44780_Mpsc *
+ * @param   HD44780_Msg *
+ *
+ * @return  char ERROR if queue is empty
+ */
+char HD44780_MpscPop (HD44780_Mpsc *queue, HD44780_Msg *msg)
+{
+  HD44780_MpscCell *cell = &queue->cells[queue->tail & (HD44780_MPSC_SIZE - 1)];
+
+  // not published yet
+  if (atomic_load_explicit(&cell->sequence, memory_order_acquire) != (queue->tail + 1)) {
+    // error
+    return ERROR;
+  }
+  // load message
+  *msg = cell->msg;
+  // cell free for position one lap later
+  atomic_store_explicit(&cell->sequence, queue->tail + HD44780_MPSC_SIZE, memory_order_release);
+  queue->tail++;
+  // success
+  return SUCCESS;
+}
@@ -0,0 +1,97 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Lock-free MPSC Queue of Linux Port
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_mpsc.h
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend
+ * ---------------------------------------------------------------+
+ * @usage       bounded queue, many producer threads, one consumer
+ *              (bus owner), every cell carries sequence number:
+ *              - producer claims position by compare and swap and
+ *                publishes message by release store of sequence
+ *              - consumer owns tail, no atomic read-modify-write
+ */
+#ifndef __HD44780_MPSC_H__
+#define __HD44780_MPSC_H__
+
+  #include <stdatomic.h>
+
+  // count of cells, power of 2
+  #ifndef HD44780_MPSC_SIZE
+    #define HD44780_MPSC_SIZE     1024
+  #endif
+  #if (HD44780_MPSC_SIZE & (HD44780_MPSC_SIZE - 1))
+    #error "HD44780_MPSC_SIZE must be power of 2"
+  #endif
+
+  // max length of text in message
+  #ifndef HD44780_MPSC_TEXT
+    #define HD44780_MPSC_TEXT     20
+  #endif
+
+  // size of cache line, head and tail do not share it
+  #define HD44780_MPSC_LINE       64
+
+  // message types
+  #define HD44780_MSG_COMMAND     0   // instruction
+  #define HD44780_MSG_TEXT        1   // text at x, y into shadow frame
+  #define HD44780_MSG_STOP        2   // bus owner exits
+
+  // message
+  typedef struct {
+    unsigned char type;                     // HD44780_MSG_*
+    unsigned char x;                        // column / instruction
+    unsigned char y;                        // row
+    char text[HD44780_MPSC_TEXT + 1];       // zero terminated text
+  } HD44780_Msg;
+
+  // cell
+  typedef struct {
+    atomic_ulong sequence;                  // position cell is ready for
+    HD44780_Msg msg;
+  } HD44780_MpscCell;
+
+  // queue
+  typedef struct {
+    _Alignas(HD44780_MPSC_LINE) atomic_ulong head;  // next position of producers
+    _Alignas(HD44780_MPSC_LINE) unsigned long tail; // next position of consumer
+    _Alignas(HD44780_MPSC_LINE) HD44780_MpscCell cells[HD44780_MPSC_SIZE];
+  } HD44780_Mpsc;
+
+  /**
+   * @desc    MPSC init, not thread safe
+   *
+   * @param   HD44780_Mpsc *
+   *
+   * @return  void
+   */
+  void HD44780_MpscInit (HD44780_Mpsc *);
+
+  /**
+   * @desc    MPSC push, any thread
+   *
+   * @param   HD44780_Mpsc *
+   * @param   const HD44780_Msg *
+   *
+   * @return  char ERROR if queue is full
+   */
+  char HD44780_MpscPush (HD44780_Mpsc *, const HD44780_Msg *);
+
+  /**
+   * @desc    MPSC pop, consumer thread only
+   *
+   * @param   HD44780_Mpsc *
+   * @param   HD44780_Msg *
+   *
+   * @return  char ERROR if queue is empty
+   */
+  char HD44780_MpscPop (HD44780_Mpsc *, HD44780_Msg *);
+
+#endif
@@ -0,0 +1,335 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Simulated GPIO of Linux Port
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_sim.c
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend      hd44780.h, hd44780_gpio.h, hd44780_sim.h
+ * ---------------------------------------------------------------+
+ * @usage       default set 16x2 LCD
+ */
+
+// include libraries
+#include <string.h>
+#include "hd44780.h"
+#include "hd44780_gpio.h"
+#include "hd44780_sim.h"
+
+// level of pin
+#define HD44780_SIM_PIN(pin)      ((HD44780_Sim.pins >> (pin)) & 1)
+// execution time [us] to cycles
+#define HD44780_SIM_US(us)        ((unsigned long long) (us) * (_FCPU / 1000000UL))
+// execution time of instructions / data write (37 us + tADD 4 us)
+#define HD44780_SIM_EXEC          HD44780_SIM_US(37)
+#define HD44780_SIM_EXEC_DATA     HD44780_SIM_US(41)
+// execution time of clear display / return home
+#define HD44780_SIM_EXEC_LONG     HD44780_SIM_US(1520)
+
+// simulated controller
+HD44780_SimState HD44780_Sim;
+
+/**
+ * @desc    Sim step address counter
+ *
+ * @param   unsigned char increment
+ *
+ * @return  void
+ */
+static void HD44780_SimStep (unsigned char increment)
+{
+  // CGRAM wraps around 64 bytes
+  if (HD44780_Sim.cgram_mode) {
+    HD44780_Sim.ac = (HD44780_Sim.ac + (increment ? 1 : -1)) & 0x3F;
+  // DDRAM 2 lines, 0x27 -> 0x40, 0x67 -> 0x00
+  } else if (increment) {
+    HD44780_Sim.ac = (HD44780_Sim.ac == 0x27) ? 0x40 : (HD44780_Sim.ac == 0x67) ? 0x00 : HD44780_Sim.ac + 1;
+  } else {
+    HD44780_Sim.ac = (HD44780_Sim.ac == 0x40) ? 0x27 : (HD44780_Sim.ac == 0x00) ? 0x67 : HD44780_Sim.ac - 1;
+  }
+}
+
+/**
+ * @desc    Sim move address counter after data access
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void HD44780_SimMove (void)
+{
+  // direction of entry mode
+  HD44780_SimStep(HD44780_Sim.entry & HD44780_ENTRY_INC);
+}
+
+/**
+ * @desc    Sim execute instruction
+ *
+ * @param   unsigned char
+ *
+ * @return  void
+ */
+static void HD44780_SimInstruction (unsigned char instruction)
+{
+  HD44780_Sim.instructions++;
+  // busy for execution time
+  HD44780_Sim.busy = HD44780_Sim.cycles + ((instruction & 0xFC) ? HD44780_SIM_EXEC : HD44780_SIM_EXEC_LONG);
+  // set DDRAM address
+  if (instruction & HD44780_POSITION) {
+    HD44780_Sim.ac = instruction & 0x7F;
+    HD44780_Sim.cgram_mode = 0;
+  // set CGRAM address
+  } else if (instruction & HD44780_CGRAM) {
+    HD44780_Sim.ac = instruction & 0x3F;
+    HD44780_Sim.cgram_mode = 1;
+  // function set, interface length
+  } else if (instruction & HD44780_FUNCTION) {
+    HD44780_Sim.function = instruction;
+    HD44780_Sim.bits8 = (instruction & 0x10) ? 1 : 0;
+    HD44780_Sim.half = 0;
+  // cursor / display shift, only cursor moves address counter
+  } else if (instruction & HD44780_SHIFT) {
+    if (!(instruction & HD44780_DISPLAY)) {
+      HD44780_SimStep(instruction & HD44780_RIGHT);
+    }
+  // display control
+  } else if (instruction & HD44780_DISP_CTRL) {
+    HD44780_Sim.display = instruction;
+  // entry mode
+  } else if (instruction & HD44780_ENTRY) {
+    HD44780_Sim.entry = instruction;
+  // return home
+  } else if (instruction & HD44780_RETURN_HOME) {
+    HD44780_Sim.ac = 0;
+    HD44780_Sim.cgram_mode = 0;
+  // display clear
+  } else if (instruction & HD44780_DISP_CLEAR) {
+    memset(HD44780_Sim.ddram, ' ', sizeof(HD44780_Sim.ddram));
+    HD44780_Sim.ac = 0;
+    HD44780_Sim.cgram_mode = 0;
+    HD44780_Sim.entry |= HD44780_ENTRY_INC;
+  }
+}
+
+/**
+ * @desc    Sim write data
+ *
+ * @param   unsigned char
+ *
+ * @return  void
+ */
+static void HD44780_SimData (unsigned char data)
+{
+  HD44780_Sim.data++;
+  // busy for execution time
+  HD44780_Sim.busy = HD44780_Sim.cycles + HD44780_SIM_EXEC_DATA;
+  // RAM selected by last set address
+  if (HD44780_Sim.cgram_mode) {
+    HD44780_Sim.cgram[HD44780_Sim.ac] = data;
+  } else {
+    HD44780_Sim.ddram[HD44780_Sim.ac & 0x7F] = data;
+  }
+  // address counter
+  HD44780_SimMove();
+}
+
+/**
+ * @desc    Sim byte driven on data bus during read
+ *
+ * @param   void
+ *
+ * @return  unsigned char
+ */
+static unsigned char HD44780_SimReadByte (void)
+{
+  // data register
+  if (HD44780_SIM_PIN(HD44780_RS)) {
+    return HD44780_Sim.cgram_mode ? HD44780_Sim.cgram[HD44780_Sim.ac] : HD44780_Sim.ddram[HD44780_Sim.ac & 0x7F];
+  }
+  // busy flag, address counter
+  return ((HD44780_Sim.cycles < HD44780_Sim.busy) ? 0x80 : 0x00) | (HD44780_Sim.ac & 0x7F);
+}
+
+/**
+ * @desc    Sim E falling edge - nibble latched or read finished
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void HD44780_SimStrobe (void)
+{
+  unsigned char nibble;
+
+  HD44780_Sim.strobes++;
+  // read, nibble phase is shared with write
+  if (HD44780_SIM_PIN(HD44780_RW)) {
+    if (!HD44780_Sim.bits8) {
+      HD44780_Sim.half ^= 1;
+    }
+    // data read moves address counter
+    if (!HD44780_Sim.half && HD44780_SIM_PIN(HD44780_RS)) {
+      HD44780_SimMove();
+    }
+    return;
+  }
+  // write ignored while busy
+  if (HD44780_Sim.cycles < HD44780_Sim.busy) {
+    return;
+  }
+  // DB7-DB4
+  nibble = (HD44780_SIM_PIN(HD44780_DATA7) << 3) |
+           (HD44780_SIM_PIN(HD44780_DATA6) << 2) |
+           (HD44780_SIM_PIN(HD44780_DATA5) << 1) |
+           (HD44780_SIM_PIN(HD44780_DATA4));
+  // 8 bit interface, DB3-DB0 not connected
+  if (HD44780_Sim.bits8) {
+    HD44780_SimInstruction(nibble << 4);
+    return;
+  }
+  // upper nibble
+  if (!HD44780_Sim.half) {
+    HD44780_Sim.upper = nibble;
+    HD44780_Sim.half = 1;
+    return;
+  }
+  // lower nibble completes byte
+  HD44780_Sim.half = 0;
+  if (HD44780_SIM_PIN(HD44780_RS)) {
+    HD44780_SimData((HD44780_Sim.upper << 4) | nibble);
+  } else {
+    HD44780_SimInstruction((HD44780_Sim.upper << 4) | nibble);
+  }
+}
+
+/**
+ * @desc    Sim open - power on state
+ *
+ * @param   void
+ *
+ * @return  char
+ */
+static char HD44780_SimOpen (void)
+{
+  // power on reset
+  memset(&HD44780_Sim, 0, sizeof(HD44780_Sim));
+  memset(HD44780_Sim.ddram, ' ', sizeof(HD44780_Sim.ddram));
+  HD44780_Sim.entry = HD44780_ENTRY | HD44780_ENTRY_INC;
+  HD44780_Sim.display = HD44780_DISP_OFF;
+  HD44780_Sim.bits8 = 1;
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Sim close
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void HD44780_SimClose (void)
+{
+}
+
+/**
+ * @desc    Sim direction of pin
+ *
+ * @param   unsigned char pin
+ * @param   unsigned char output
+ *
+ * @return  void
+ */
+static void HD44780_SimDirection (unsigned char pin, unsigned char output)
+{
+  // sbi / cbi
+  HD44780_Sim.cycles += HD44780_CYC_SBI;
+  if (output) {
+    HD44780_Sim.outputs |= (1 << pin);
+  } else {
+    HD44780_Sim.outputs &= ~(1 << pin);
+  }
+}
+
+/**
+ * @desc    Sim write pin
+ *
+ * @param   unsigned char pin
+ * @param   unsigned char level
+ *
+ * @return  void
+ */
+static void HD44780_SimWrite (unsigned char pin, unsigned char level)
+{
+  unsigned char e = HD44780_SIM_PIN(HD44780_E);
+
+  // sbi / cbi
+  HD44780_Sim.cycles += HD44780_CYC_SBI;
+  if (level) {
+    HD44780_Sim.pins |= (1 << pin);
+  } else {
+    HD44780_Sim.pins &= ~(1 << pin);
+  }
+  // E falling edge
+  if ((pin == HD44780_E) && e && !level) {
+    HD44780_SimStrobe();
+  }
+}
+
+/**
+ * @desc    Sim read pins
+ *
+ * @param   unsigned char mask of input pins
+ *
+ * @return  unsigned char
+ */
+static unsigned char HD44780_SimRead (unsigned char mask)
+{
+  unsigned char byte;
+  unsigned char nibble;
+  unsigned char levels;
+
+  // in
+  HD44780_Sim.cycles += HD44780_CYC_IN;
+  // pull ups
+  levels = HD44780_Sim.pins;
+  // controller drives DB7-DB4 while E is high in read
+  if (HD44780_SIM_PIN(HD44780_RW) && HD44780_SIM_PIN(HD44780_E)) {
+    byte = HD44780_SimReadByte();
+    nibble = (HD44780_Sim.bits8 || !HD44780_Sim.half) ? (byte >> 4) : (byte & 0x0F);
+    levels &= ~((1 << HD44780_DATA7) | (1 << HD44780_DATA6) | (1 << HD44780_DATA5) | (1 << HD44780_DATA4));
+    levels |= ((nibble >> 3) & 1) << HD44780_DATA7;
+    levels |= ((nibble >> 2) & 1) << HD44780_DATA6;
+    levels |= ((nibble >> 1) & 1) << HD44780_DATA5;
+    levels |= (nibble & 1) << HD44780_DATA4;
+  }
+  // inputs only
+  return levels & mask;
+}
+
+/**
+ * @desc    Sim delay - virtual clock advances, no wait
+ *
+ * @param   unsigned long cycles
+ *
+ * @return  void
+ */
+static void HD44780_SimDelay (unsigned long cycles)
+{
+  HD44780_Sim.cycles += cycles;
+}
+
+// simulated GPIO
+const HD44780_GpioOps HD44780_GpioSim = {
+  HD44780_SimOpen,
+  HD44780_SimClose,
+  HD44780_SimDirection,
+  HD44780_SimWrite,
+  HD44780_SimRead,
+  HD44780_SimDelay
+};
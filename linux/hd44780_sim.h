@@ -0,0 +1,49 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Simulated GPIO of Linux Port
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_sim.h
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend      hd44780_gpio.h
+ * ---------------------------------------------------------------+
+ * @usage       pins are connected to model of HD44780 controller
+ *              in 4 bit mode, state is readable from HD44780_Sim,
+ *              busy flag is set for execution time of datasheet
+ *              and E strobes of writes are ignored while busy
+ */
+#ifndef __HD44780_SIM_H__
+#define __HD44780_SIM_H__
+
+  #include "hd44780_gpio.h"
+
+  // state of simulated controller
+  typedef struct {
+    unsigned char ddram[128];     // display data RAM
+    unsigned char cgram[64];      // character generator RAM
+    unsigned char ac;             // address counter
+    unsigned char cgram_mode;     // address counter points to CGRAM
+    unsigned char entry;          // entry mode register
+    unsigned char display;        // display control register
+    unsigned char function;       // function set register
+    unsigned char bits8;          // 8 bit interface (after power on)
+    unsigned char half;           // upper nibble received / read
+    unsigned char upper;          // received upper nibble
+    unsigned char pins;           // levels driven by driver
+    unsigned char outputs;        // pins driven by driver
+    unsigned long long cycles;    // virtual clock of _FCPU
+    unsigned long long busy;      // clock when execution finishes
+    unsigned long strobes;        // E falling edges
+    unsigned long instructions;   // executed instructions
+    unsigned long data;           // written data bytes
+  } HD44780_SimState;
+
+  // simulated controller
+  extern HD44780_SimState HD44780_Sim;
+
+#endif
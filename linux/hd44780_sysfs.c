@@ -0,0 +1,260 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Sysfs GPIO of Linux Port
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_sysfs.c
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend      hd44780.h, hd44780_gpio.h
+ * ---------------------------------------------------------------+
+ * @usage       pins of virtual port D mapped to GPIO lines by
+ *              HD44780_SYSFS_LINES (index is bit, -1 not used),
+ *              default Raspberry Pi header: RS - GPIO25, RW - GPIO24,
+ *              E - GPIO23, DB4 - GPIO17, DB5 - GPIO18, DB6 - GPIO27,
+ *              DB7 - GPIO22
+ */
+
+// include libraries
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "hd44780.h"
+#include "hd44780_gpio.h"
+
+// GPIO lines of bits 0 - 7
+#ifndef HD44780_SYSFS_LINES
+  #define HD44780_SYSFS_LINES     { -1, 25, 24, 23, 17, 18, 27, 22 }
+#endif
+
+// sysfs root
+#define HD44780_SYSFS_PATH        "/sys/class/gpio"
+// delays longer than this [ns] sleep instead of busy wait
+#define HD44780_SYSFS_SLEEP       100000UL
+
+// GPIO lines
+static const int HD44780_SysfsLine[8] = HD44780_SYSFS_LINES;
+// value files
+static int HD44780_SysfsFd[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };
+// last written levels, writes of same level are skipped
+static unsigned char HD44780_SysfsLevel = 0;
+// outputs
+static unsigned char HD44780_SysfsOutput = 0;
+
+/**
+ * @desc    Sysfs write string to attribute file
+ *
+ * @param   const char * path
+ * @param   const char * value
+ *
+ * @return  char
+ */
+static char HD44780_SysfsPut (const char *path, const char *value)
+{
+  ssize_t length;
+  int fd;
+
+  // open attribute
+  fd = open(path, O_WRONLY);
+  if (fd < 0) {
+    // error
+    return ERROR;
+  }
+  length = write(fd, value, strlen(value));
+  close(fd);
+  // success if whole value written
+  return (length == (ssize_t) strlen(value)) ? SUCCESS : ERROR;
+}
+
+/**
+ * @desc    Sysfs close - unexport lines
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void HD44780_SysfsClose (void)
+{
+  char number[12];
+  unsigned char i;
+
+  // loop through bits
+  for (i = 0; i < 8; i++) {
+    if (HD44780_SysfsFd[i] < 0) {
+      continue;
+    }
+    close(HD44780_SysfsFd[i]);
+    HD44780_SysfsFd[i] = -1;
+    snprintf(number, sizeof(number), "%d", HD44780_SysfsLine[i]);
+    HD44780_SysfsPut(HD44780_SYSFS_PATH "/unexport", number);
+  }
+}
+
+/**
+ * @desc    Sysfs open - export lines, all inputs
+ *
+ * @param   void
+ *
+ * @return  char
+ */
+static char HD44780_SysfsOpen (void)
+{
+  char path[64];
+  char number[12];
+  unsigned char i;
+
+  // loop through bits
+  for (i = 0; i < 8; i++) {
+    // not used
+    if (HD44780_SysfsLine[i] < 0) {
+      continue;
+    }
+    // export, line may be exported already
+    snprintf(number, sizeof(number), "%d", HD44780_SysfsLine[i]);
+    HD44780_SysfsPut(HD44780_SYSFS_PATH "/export", number);
+    // input
+    snprintf(path, sizeof(path), HD44780_SYSFS_PATH "/gpio%d/direction", HD44780_SysfsLine[i]);
+    if (HD44780_SysfsPut(path, "in") == ERROR) {
+      HD44780_SysfsClose();
+      // error
+      return ERROR;
+    }
+    // value file stays open
+    snprintf(path, sizeof(path), HD44780_SYSFS_PATH "/gpio%d/value", HD44780_SysfsLine[i]);
+    HD44780_SysfsFd[i] = open(path, O_RDWR);
+    if (HD44780_SysfsFd[i] < 0) {
+      HD44780_SysfsClose();
+      // error
+      return ERROR;
+    }
+  }
+  HD44780_SysfsLevel = 0;
+  HD44780_SysfsOutput = 0;
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Sysfs direction of pin, output starts at last written level
+ *
+ * @param   unsigned char pin
+ * @param   unsigned char output
+ *
+ * @return  void
+ */
+static void HD44780_SysfsDirection (unsigned char pin, unsigned char output)
+{
+  char path[64];
+
+  // not used or unchanged
+  if ((HD44780_SysfsFd[pin] < 0) || (((HD44780_SysfsOutput >> pin) & 1) == output)) {
+    return;
+  }
+  snprintf(path, sizeof(path), HD44780_SYSFS_PATH "/gpio%d/direction", HD44780_SysfsLine[pin]);
+  // "high" / "low" sets output without glitch
+  if (output) {
+    HD44780_SysfsPut(path, ((HD44780_SysfsLevel >> pin) & 1) ? "high" : "low");
+    HD44780_SysfsOutput |= (1 << pin);
+  } else {
+    HD44780_SysfsPut(path, "in");
+    HD44780_SysfsOutput &= ~(1 << pin);
+  }
+}
+
+/**
+ * @desc    Sysfs write pin, level of input is kept for output
+ *
+ * @param   unsigned char pin
+ * @param   unsigned char level
+ *
+ * @return  void
+ */
+static void HD44780_SysfsWrite (unsigned char pin, unsigned char level)
+{
+  // not used or unchanged
+  if ((HD44780_SysfsFd[pin] < 0) || (((HD44780_SysfsLevel >> pin) & 1) == level)) {
+    return;
+  }
+  if (level) {
+    HD44780_SysfsLevel |= (1 << pin);
+  } else {
+    HD44780_SysfsLevel &= ~(1 << pin);
+  }
+  // input, no pull up through sysfs
+  if (!((HD44780_SysfsOutput >> pin) & 1)) {
+    return;
+  }
+  // failed write is retried by next write of same level
+  if (pwrite(HD44780_SysfsFd[pin], level ? "1" : "0", 1, 0) != 1) {
+    HD44780_SysfsLevel ^= (1 << pin);
+  }
+}
+
+/**
+ * @desc    Sysfs read pins
+ *
+ * @param   unsigned char mask of input pins
+ *
+ * @return  unsigned char
+ */
+static unsigned char HD44780_SysfsRead (unsigned char mask)
+{
+  unsigned char levels = 0;
+  unsigned char i;
+  char value;
+
+  // loop through required pins
+  for (i = 0; i < 8; i++) {
+    if (!((mask >> i) & 1) || (HD44780_SysfsFd[i] < 0)) {
+      continue;
+    }
+    if ((pread(HD44780_SysfsFd[i], &value, 1, 0) == 1) && (value == '1')) {
+      levels |= (1 << i);
+    }
+  }
+  return levels;
+}
+
+/**
+ * @desc    Sysfs delay
+ *
+ * @param   unsigned long cycles of _FCPU
+ *
+ * @return  void
+ */
+static void HD44780_SysfsDelay (unsigned long cycles)
+{
+  unsigned long long ns = (unsigned long long) cycles * 1000000000ULL / _FCPU;
+  unsigned long long end;
+  struct timespec now;
+
+  // long delay sleeps
+  if (ns >= HD44780_SYSFS_SLEEP) {
+    now.tv_sec = ns / 1000000000ULL;
+    now.tv_nsec = ns % 1000000000ULL;
+    nanosleep(&now, NULL);
+    return;
+  }
+  // short delay busy waits, syscalls of pin access usually exceed it
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  end = now.tv_sec * 1000000000ULL + now.tv_nsec + ns;
+  do {
+    clock_gettime(CLOCK_MONOTONIC, &now);
+  } while ((now.tv_sec * 1000000000ULL + now.tv_nsec) < end);
+}
+
+// sysfs GPIO
+const HD44780_GpioOps HD44780_GpioSysfs = {
+  HD44780_SysfsOpen,
+  HD44780_SysfsClose,
+  HD44780_SysfsDirection,
+  HD44780_SysfsWrite,
+  HD44780_SysfsRead,
+  HD44780_SysfsDelay
+};
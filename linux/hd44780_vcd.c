@@ -0,0 +1,68 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Linux Port - Bus Capture of Driver
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_vcd.c
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend      hd44780.h, hd44780_capture.h, hd44780_sim.h
+ * ---------------------------------------------------------------+
+ * @usage       hd44780_vcd [file.vcd]
+ *              drives simulated display through capture (init,
+ *              text, busy flag and address reads), writes VCD and
+ *              report of timing check, exit status 1 on violation,
+ *              timing is tuned by -DHD44780_T_* in HOSTCFLAGS
+ */
+
+// include libraries
+#include <stdio.h>
+#include "hd44780.h"
+#include "hd44780_capture.h"
+#include "hd44780_sim.h"
+
+/**
+ * @desc    Main
+ *
+ * @param   int
+ * @param   char **
+ *
+ * @return  int
+ */
+int main (int argc, char **argv)
+{
+  const char *path = (argc > 1) ? argv[1] : "hd44780.vcd";
+  unsigned long violations;
+
+  // simulated display behind capture
+  HD44780_CaptureSelect(&HD44780_GpioSim);
+  if (HD44780_GpioSelect(&HD44780_GpioCapture) == ERROR) {
+    fprintf(stderr, "gpio select failed\n");
+    return 1;
+  }
+  // init, writes of instructions and data, busy flag reads
+  HD44780_Init();
+  HD44780_DisplayOn();
+  HD44780_PositionXY(0, 0);
+  HD44780_DrawString("HD44780");
+  HD44780_PositionXY(0, 1);
+  HD44780_DrawString("capture");
+  // address counter read
+  HD44780_ReadAddress();
+  HD44780_GpioRelease();
+
+  // export
+  if (HD44780_CaptureVcd(path) == ERROR) {
+    fprintf(stderr, "%s: write failed\n", path);
+    return 1;
+  }
+  printf("%s written\n", path);
+  // timing check
+  violations = HD44780_CaptureCheck(stdout);
+  // exit status
+  return violations ? 1 : 0;
+}
@@ -0,0 +1,33 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        AVR Delay of Linux Port
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        delay.h
+ * @tested      Linux, simulated GPIO
+ *
+ * @depend      hd44780_gpio.h
+ * ---------------------------------------------------------------+
+ * @usage       replaces <util/delay.h> when built with -Ilinux,
+ *              delay is passed to GPIO backend in cycles of F_CPU
+ */
+#ifndef __HD44780_UTIL_DELAY_H__
+#define __HD44780_UTIL_DELAY_H__
+
+  #include "hd44780_gpio.h"
+
+  // clock of virtual cycles
+  #ifndef F_CPU
+    #define F_CPU               16000000UL
+  #endif
+
+  // delay in microseconds
+  #define _delay_us(us)         HD44780_GpioDelay((unsigned long) ((us) * (F_CPU / 1000000UL)))
+  // delay in milliseconds
+  #define _delay_ms(ms)         HD44780_GpioDelay((unsigned long) ((ms) * (F_CPU / 1000UL)))
+
+#endif
@@ -16,6 +16,9 @@
 // include libraries
 #include <util/delay.h>
 #include "lib/hd44780.h"
+#include "lib/hd44780_screen.h"
+// compiled from screens/demo.scr by make
+#include "screens/demo.h"
 
 /**
  * @desc    Main function
@@ -30,17 +33,12 @@ int main (void)
 
   // DISPALY ON
   // --------------------------
-  // display clear
-  HD44780_DisplayClear();
-  // set position
-  HD44780_PositionXY(0, 0);
-  // send char
-  HD44780_DrawString("DISPLAY ON");
-  // display clear
-  HD44780_DisplayOn();
+  // precompiled stream - clear, text, display on
+  HD44780_Play(HD44780_ScreenSplash);
   // delay
   _delay_ms(2000);
 
+#if HD44780_USE_CURSOR
   // CURSOR ON & DISPLAY ON
   // --------------------------
   // display clear
@@ -77,6 +75,7 @@ int main (void)
   HD44780_DrawString("CURSOR OFF");
   // delay
   HD44780_CursorOff();
+#endif
 
   // EXIT
   // ------------------------------------------------- 
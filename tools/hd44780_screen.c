@@ -0,0 +1,565 @@
+/**
+ * ---------------------------------------------------------------+
+ * @desc        HD44780 Screen Compiler
+ * ---------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        hd44780_screen.c
+ * @tested      Linux
+ *
+ * @depend      hd44780.h, hd44780_screen.h
+ * ---------------------------------------------------------------+
+ * @usage       hd44780_screen [-e] file.scr file.h
+ *              compiles screen descriptions into byte streams of
+ *              HD44780_Play (PROGMEM, -e EEMEM), geometry is taken
+ *              from hd44780.h, description lines (# comment):
+ *              - screen Name             stream HD44780_ScreenName
+ *              - clear                   clear display, text before
+ *                                        is dropped
+ *              - text x y "string"       escapes \" \\ \xNN
+ *              - glyph slot r0 ... r7    CGRAM slot, uploaded first
+ *              - display on|off [cursor] [blink]
+ *              stream is compiled from final content: one clear,
+ *              cells known to hold same char are not sent, one set
+ *              address per run, none where address counter already
+ *              points, display control last
+ */
+
+// include libraries
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hd44780.h"
+#include "hd44780_screen.h"
+
+// longest line of description
+#define HD44780_SCREEN_LINE       256
+// longest stream
+#define HD44780_SCREEN_MAX        1024
+// clean gap up to this count of cells is resent instead of set address
+#define HD44780_SCREEN_GAP        1
+// address counter unknown
+#define HD44780_SCREEN_AC_UNKNOWN -1
+
+// description of screen
+typedef struct {
+  char name[64];                                // name of stream
+  unsigned char clear;                          // display cleared
+  char cells[HD44780_ROWS][HD44780_COLS];       // content
+  unsigned char written[HD44780_ROWS][HD44780_COLS]; // cells set by text
+  unsigned char glyphs[64];                     // CGRAM rows
+  unsigned char defined;                        // glyph slots (bit per slot)
+  int display;                                  // display control, -1 kept
+} HD44780_ScreenDesc;
+
+// compiled stream
+typedef struct {
+  unsigned char bytes[HD44780_SCREEN_MAX];
+  unsigned int length;
+} HD44780_ScreenStream;
+
+// start of rows in DDRAM
+static const unsigned char HD44780_RowStart[4] = {
+  HD44780_ROW1_START,
+  HD44780_ROW2_START,
+  HD44780_ROW3_START,
+  HD44780_ROW4_START
+};
+
+// description file and line for errors
+static const char *HD44780_File;
+static unsigned int HD44780_Line;
+// output removed on error
+static const char *HD44780_Output;
+
+/**
+ * @desc    Error with file and line, exit
+ *
+ * @param   const char * message
+ *
+ * @return  void
+ */
+static void HD44780_ScreenError (const char *message)
+{
+  fprintf(stderr, "%s:%u: %s\n", HD44780_File, HD44780_Line, message);
+  // no stale header for make
+  if (HD44780_Output) {
+    remove(HD44780_Output);
+  }
+  exit(1);
+}
+
+/**
+ * @desc    Next token of line, quoted string with escapes
+ *
+ * @param   char ** position in line, moved behind token
+ * @param   char * token
+ * @param   unsigned int * length of token (string may hold 0)
+ *
+ * @return  int {0 - end of line; 1 - word; 2 - string}
+ */
+static int HD44780_ScreenToken (char **line, char *token, unsigned int *length)
+{
+  char *p = *line;
+  char hex[3] = { 0 };
+  unsigned int n = 0;
+  int type = 1;
+
+  // skip spaces
+  while (isspace((unsigned char) *p)) {
+    p++;
+  }
+  // end of line or comment
+  if ((*p == '\0') || (*p == '#')) {
+    return 0;
+  }
+  // quoted string
+  if (*p == '"') {
+    type = 2;
+    p++;
+    while (*p != '"') {
+      if ((*p == '\0') || (n >= (HD44780_SCREEN_LINE - 1))) {
+        HD44780_ScreenError("unterminated string");
+      }
+      // escape
+      if (*p == '\\') {
+        p++;
+        if (*p == 'x') {
+          if (!isxdigit((unsigned char) p[1]) || !isxdigit((unsigned char) p[2])) {
+            HD44780_ScreenError("escape \\x needs 2 hex digits");
+          }
+          hex[0] = p[1];
+          hex[1] = p[2];
+          token[n++] = (char) strtol(hex, NULL, 16);
+          p += 3;
+          continue;
+        } else if ((*p != '"') && (*p != '\\')) {
+          HD44780_ScreenError("unknown escape");
+        }
+      }
+      token[n++] = *p++;
+    }
+    p++;
+  // word
+  } else {
+    while (*p && !isspace((unsigned char) *p) && (n < (HD44780_SCREEN_LINE - 1))) {
+      token[n++] = *p++;
+    }
+  }
+  token[n] = '\0';
+  *length = n;
+  *line = p;
+  return type;
+}
+
+/**
+ * @desc    Number of word, decimal or 0x hex
+ *
+ * @param   char ** position in line
+ * @param   long max
+ *
+ * @return  long
+ */
+static long HD44780_ScreenNumber (char **line, long max)
+{
+  char token[HD44780_SCREEN_LINE];
+  unsigned int length;
+  char *end;
+  long value;
+
+  // word
+  if (HD44780_ScreenToken(line, token, &length) != 1) {
+    HD44780_ScreenError("number expected");
+  }
+  value = strtol(token, &end, 0);
+  // range
+  if ((*end != '\0') || (value < 0) || (value > max)) {
+    HD44780_ScreenError("number out of range");
+  }
+  return value;
+}
+
+/**
+ * @desc    Append record to stream
+ *
+ * @param   HD44780_ScreenStream *
+ * @param   const unsigned char * bytes
+ * @param   unsigned int count
+ *
+ * @return  void
+ */
+static void HD44780_ScreenEmit (HD44780_ScreenStream *stream, const unsigned char *bytes, unsigned int count)
+{
+  // room for record and end
+  if ((stream->length + count + 2) > HD44780_SCREEN_MAX) {
+    HD44780_ScreenError("stream too long");
+  }
+  memcpy(&stream->bytes[stream->length], bytes, count);
+  stream->length += count;
+}
+
+/**
+ * @desc    Append data bytes in runs of HD44780_SCREEN_DATA
+ *
+ * @param   HD44780_ScreenStream *
+ * @param   const unsigned char * data
+ * @param   unsigned int count
+ *
+ * @return  void
+ */
+static void HD44780_ScreenData (HD44780_ScreenStream *stream, const unsigned char *data, unsigned int count)
+{
+  unsigned char run;
+
+  // loop through runs
+  while (count) {
+    run = (count > HD44780_SCREEN_DATA) ? HD44780_SCREEN_DATA : count;
+    HD44780_ScreenEmit(stream, &run, 1);
+    HD44780_ScreenEmit(stream, data, run);
+    data += run;
+    count -= run;
+  }
+}
+
+/**
+ * @desc    Cell has to be sent
+ *
+ * @param   HD44780_ScreenDesc *
+ * @param   unsigned char x
+ * @param   unsigned char y
+ *
+ * @return  int
+ */
+static int HD44780_ScreenSend (HD44780_ScreenDesc *screen, unsigned char x, unsigned char y)
+{
+  // cleared display holds spaces
+  return screen->written[y][x] && !(screen->clear && (screen->cells[y][x] == ' '));
+}
+
+/**
+ * @desc    Compile screen into stream
+ *
+ * @param   HD44780_ScreenDesc *
+ * @param   HD44780_ScreenStream *
+ *
+ * @return  void
+ */
+static void HD44780_ScreenCompile (HD44780_ScreenDesc *screen, HD44780_ScreenStream *stream)
+{
+  unsigned char record[2];
+  unsigned char data[HD44780_COLS];
+  int ac = HD44780_SCREEN_AC_UNKNOWN;
+  unsigned char first;
+  unsigned char last;
+  unsigned char slot = 0;
+  unsigned char x;
+  unsigned char y;
+  unsigned char i;
+
+  stream->length = 0;
+  // glyphs first, one set CGRAM address per run of slots
+  while (slot < 8) {
+    if (!(screen->defined & (1 << slot))) {
+      slot++;
+      continue;
+    }
+    first = slot;
+    while ((slot < 8) && (screen->defined & (1 << slot))) {
+      slot++;
+    }
+    record[0] = HD44780_CGRAM | (first << 3);
+    HD44780_ScreenEmit(stream, record, 1);
+    HD44780_ScreenData(stream, &screen->glyphs[first << 3], (slot - first) << 3);
+  }
+  // clear, address counter goes to 0
+  if (screen->clear) {
+    record[0] = HD44780_SCREEN_ESC;
+    record[1] = HD44780_DISP_CLEAR;
+    HD44780_ScreenEmit(stream, record, 2);
+    ac = 0;
+  }
+  // loop through rows
+  for (y = 0; y < HD44780_ROWS; y++) {
+    x = 0;
+    while (x < HD44780_COLS) {
+      // cell already on display
+      if (!HD44780_ScreenSend(screen, x, y)) {
+        x++;
+        continue;
+      }
+      // end of run, short gaps of known cells are resent
+      last = x;
+      for (i = x + 1; i < HD44780_COLS; i++) {
+        if (HD44780_ScreenSend(screen, i, y)) {
+          last = i;
+        } else if (!(screen->written[y][i] || screen->clear) || ((i - last) > HD44780_SCREEN_GAP)) {
+          break;
+        }
+      }
+      // set address unless counter points to run
+      if (ac != (HD44780_RowStart[y] + x)) {
+        record[0] = HD44780_POSITION | (HD44780_RowStart[y] + x);
+        HD44780_ScreenEmit(stream, record, 1);
+      }
+      // run, unwritten cells of cleared display are spaces
+      for (i = x; i <= last; i++) {
+        data[i - x] = screen->written[y][i] ? screen->cells[y][i] : ' ';
+      }
+      HD44780_ScreenData(stream, data, last - x + 1);
+      ac = HD44780_RowStart[y] + last + 1;
+      x = last + 1;
+    }
+  }
+  // display control last, content appears at once
+  if (screen->display >= 0) {
+    record[0] = HD44780_SCREEN_ESC;
+    record[1] = screen->display;
+    HD44780_ScreenEmit(stream, record, 2);
+  }
+  // end
+  record[0] = HD44780_SCREEN_ESC;
+  record[1] = HD44780_SCREEN_END;
+  HD44780_ScreenEmit(stream, record, 2);
+}
+
+/**
+ * @desc    Write stream as array, one record per line
+ *
+ * @param   FILE * output
+ * @param   HD44780_ScreenDesc *
+ * @param   HD44780_ScreenStream *
+ * @param   int eeprom
+ *
+ * @return  void
+ */
+static void HD44780_ScreenWrite (FILE *out, HD44780_ScreenDesc *screen, HD44780_ScreenStream *stream, int eeprom)
+{
+  unsigned int p = 0;
+  unsigned int count;
+  unsigned int i;
+  unsigned char b;
+
+  fprintf(out, "\n  // %s - %u bytes\n", screen->name, stream->length);
+  fprintf(out, "  static const unsigned char HD44780_Screen%s[] %s = {\n", screen->name, eeprom ? "EEMEM" : "PROGMEM");
+  // loop through records
+  while (p < stream->length) {
+    b = stream->bytes[p];
+    fprintf(out, "    ");
+    // instruction or end
+    if (b == HD44780_SCREEN_ESC) {
+      fprintf(out, "0x%02X, 0x%02X,", b, stream->bytes[p + 1]);
+      if (stream->bytes[p + 1] == HD44780_SCREEN_END) {
+        fprintf(out, "  // end\n");
+      } else if (stream->bytes[p + 1] == HD44780_DISP_CLEAR) {
+        fprintf(out, "  // clear display\n");
+      } else if ((stream->bytes[p + 1] & 0xF8) == HD44780_DISP_CTRL) {
+        fprintf(out, "  // display control\n");
+      } else {
+        fprintf(out, "  // instruction\n");
+      }
+      p += 2;
+    // set address
+    } else if (b > HD44780_SCREEN_DATA) {
+      fprintf(out, "0x%02X,  // %s 0x%02X\n", b, (b & HD44780_POSITION) ? "DDRAM" : "CGRAM", b & ((b & HD44780_POSITION) ? 0x7F : 0x3F));
+      p++;
+    // data run, text in comment
+    } else {
+      count = b;
+      fprintf(out, "0x%02X,", b);
+      for (i = 1; i <= count; i++) {
+        fprintf(out, " 0x%02X,", stream->bytes[p + i]);
+      }
+      fprintf(out, "  // \"");
+      for (i = 1; i <= count; i++) {
+        b = stream->bytes[p + i];
+        fputc(((b >= 0x20) && (b < 0x7F) && (b != '\\')) ? b : '.', out);
+      }
+      fprintf(out, "\"\n");
+      p += count + 1;
+    }
+  }
+  fprintf(out, "  };\n");
+}
+
+/**
+ * @desc    Start screen
+ *
+ * @param   HD44780_ScreenDesc *
+ * @param   const char * name
+ *
+ * @return  void
+ */
+static void HD44780_ScreenStart (HD44780_ScreenDesc *screen, const char *name)
+{
+  unsigned int i;
+
+  // C identifier
+  if (!isalpha((unsigned char) name[0]) || (strlen(name) >= sizeof(screen->name))) {
+    HD44780_ScreenError("invalid screen name");
+  }
+  for (i = 0; name[i]; i++) {
+    if (!isalnum((unsigned char) name[i]) && (name[i] != '_')) {
+      HD44780_ScreenError("invalid screen name");
+    }
+  }
+  // empty, display kept
+  memset(screen, 0, sizeof(*screen));
+  strcpy(screen->name, name);
+  screen->display = -1;
+}
+
+/**
+ * @desc    Main
+ *
+ * @param   int
+ * @param   char **
+ *
+ * @return  int
+ */
+int main (int argc, char **argv)
+{
+  HD44780_ScreenDesc screen;
+  HD44780_ScreenStream stream;
+  char line[HD44780_SCREEN_LINE];
+  char token[HD44780_SCREEN_LINE];
+  char guard[HD44780_SCREEN_LINE];
+  const char *base;
+  unsigned int length;
+  unsigned int i;
+  int started = 0;
+  int eeprom = 0;
+  long x;
+  long y;
+  char *p;
+  FILE *in;
+  FILE *out;
+
+  // options
+  if ((argc > 1) && !strcmp(argv[1], "-e")) {
+    eeprom = 1;
+    argv++;
+    argc--;
+  }
+  if (argc != 3) {
+    fprintf(stderr, "usage: %s [-e] file.scr file.h\n", argv[0]);
+    return 1;
+  }
+  HD44780_File = argv[1];
+  if ((in = fopen(argv[1], "r")) == NULL) {
+    perror(argv[1]);
+    return 1;
+  }
+  if ((out = fopen(argv[2], "w")) == NULL) {
+    perror(argv[2]);
+    return 1;
+  }
+  HD44780_Output = argv[2];
+  // include guard from name of output
+  base = strrchr(argv[2], '/') ? strrchr(argv[2], '/') + 1 : argv[2];
+  for (i = 0; base[i] && (i < (sizeof(guard) - 1)); i++) {
+    guard[i] = isalnum((unsigned char) base[i]) ? toupper((unsigned char) base[i]) : '_';
+  }
+  guard[i] = '\0';
+  fprintf(out, "/**\n * generated by hd44780_screen from %s, do not edit\n */\n", argv[1]);
+  fprintf(out, "#ifndef __HD44780_SCREEN_%s__\n#define __HD44780_SCREEN_%s__\n\n", guard, guard);
+  fprintf(out, "  #include <%s>\n", eeprom ? "avr/eeprom.h" : "avr/pgmspace.h");
+
+  // loop through lines
+  while (fgets(line, sizeof(line), in)) {
+    HD44780_Line++;
+    p = line;
+    // empty line
+    if (HD44780_ScreenToken(&p, token, &length) == 0) {
+      continue;
+    }
+    // new screen, previous is written
+    if (!strcmp(token, "screen")) {
+      if (started) {
+        HD44780_ScreenCompile(&screen, &stream);
+        HD44780_ScreenWrite(out, &screen, &stream, eeprom);
+        fprintf(stderr, "%s: %u bytes\n", screen.name, stream.length);
+      }
+      if (HD44780_ScreenToken(&p, token, &length) != 1) {
+        HD44780_ScreenError("screen name expected");
+      }
+      HD44780_ScreenStart(&screen, token);
+      started = 1;
+      continue;
+    }
+    if (!started) {
+      HD44780_ScreenError("screen expected");
+    }
+    // clear, earlier text is erased
+    if (!strcmp(token, "clear")) {
+      memset(screen.written, 0, sizeof(screen.written));
+      screen.clear = 1;
+    // text into cells
+    } else if (!strcmp(token, "text")) {
+      x = HD44780_ScreenNumber(&p, HD44780_COLS - 1);
+      y = HD44780_ScreenNumber(&p, HD44780_ROWS - 1);
+      if (HD44780_ScreenToken(&p, token, &length) != 2) {
+        HD44780_ScreenError("quoted string expected");
+      }
+      if ((x + length) > HD44780_COLS) {
+        HD44780_ScreenError("text does not fit row");
+      }
+      for (i = 0; i < length; i++) {
+        screen.cells[y][x + i] = token[i];
+        screen.written[y][x + i] = 1;
+      }
+    // glyph rows
+    } else if (!strcmp(token, "glyph")) {
+      x = HD44780_ScreenNumber(&p, 7);
+      for (i = 0; i < 8; i++) {
+        screen.glyphs[(x << 3) + i] = HD44780_ScreenNumber(&p, 0x1F);
+      }
+      screen.defined |= 1 << x;
+    // display control
+    } else if (!strcmp(token, "display")) {
+      if (HD44780_ScreenToken(&p, token, &length) != 1) {
+        HD44780_ScreenError("on or off expected");
+      }
+      if (!strcmp(token, "on")) {
+        screen.display = HD44780_DISP_CTRL | HD44780_DISP_D;
+      } else if (!strcmp(token, "off")) {
+        screen.display = HD44780_DISP_CTRL;
+      } else {
+        HD44780_ScreenError("on or off expected");
+      }
+      while (HD44780_ScreenToken(&p, token, &length) == 1) {
+        if (!strcmp(token, "cursor")) {
+          screen.display |= HD44780_DISP_C;
+        } else if (!strcmp(token, "blink")) {
+          screen.display |= HD44780_DISP_B;
+        } else {
+          HD44780_ScreenError("cursor or blink expected");
+        }
+      }
+    } else {
+      HD44780_ScreenError("unknown command");
+    }
+    // rest of line
+    if (HD44780_ScreenToken(&p, token, &length) != 0) {
+      HD44780_ScreenError("unexpected token");
+    }
+  }
+  // last screen
+  if (started) {
+    HD44780_ScreenCompile(&screen, &stream);
+    HD44780_ScreenWrite(out, &screen, &stream, eeprom);
+    fprintf(stderr, "%s: %u bytes\n", screen.name, stream.length);
+  }
+  fprintf(out, "\n#endif\n");
+  fclose(in);
+  // output complete
+  if (fclose(out) != 0) {
+    perror(argv[2]);
+    remove(argv[2]);
+    return 1;
+  }
+  return 0;
+}